@@ -0,0 +1,57 @@
+#include "AliasTable.h"
+#include <algorithm>
+
+// ============================================
+// Construction (Vose's method)
+// ============================================
+void AliasTable::build(const double* weights, int count) {
+    threshold.assign(count, 0);
+    alias.assign(count, 0);
+    if (count <= 0) {
+        return;
+    }
+
+    double total = 0.0;
+    for (int i = 0; i < count; i++) {
+        total += std::max(0.0, weights[i]);
+    }
+
+    // Scale so the average column holds exactly 1
+    std::vector<double> scaled(count);
+    for (int i = 0; i < count; i++) {
+        scaled[i] = total > 0.0 ? std::max(0.0, weights[i]) * count / total : 1.0;
+    }
+
+    std::vector<int> small;
+    std::vector<int> large;
+    for (int i = 0; i < count; i++) {
+        (scaled[i] < 1.0 ? small : large).push_back(i);
+    }
+
+    // Each under-full column is topped up from one over-full column
+    const double scale = 4294967296.0;  // 2^32
+    while (!small.empty() && !large.empty()) {
+        int less = small.back();
+        small.pop_back();
+        int more = large.back();
+
+        threshold[less] = static_cast<uint32_t>(scaled[less] * scale);
+        alias[less] = static_cast<uint32_t>(more);
+
+        scaled[more] -= 1.0 - scaled[less];
+        if (scaled[more] < 1.0) {
+            large.pop_back();
+            small.push_back(more);
+        }
+    }
+
+    // Leftovers are full up to rounding error
+    for (int i : large) {
+        threshold[i] = UINT32_MAX;
+        alias[i] = static_cast<uint32_t>(i);
+    }
+    for (int i : small) {
+        threshold[i] = UINT32_MAX;
+        alias[i] = static_cast<uint32_t>(i);
+    }
+}
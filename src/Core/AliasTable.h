@@ -0,0 +1,36 @@
+#ifndef ALIASTABLE_H
+#define ALIASTABLE_H
+
+#include <cstdint>
+#include <vector>
+#include "Random.h"
+
+// ============================================
+// ALIAS TABLE (Walker / Vose)
+// ============================================
+// Samples index i with probability weights[i] / sum(weights) in O(1):
+// one random word picks a column (high 32 bits) and decides between the
+// column and its alias (low 32 bits). Built once per set of weights;
+// sampling never allocates.
+class AliasTable {
+private:
+    std::vector<uint32_t> threshold;  // Keep the column if low bits < threshold (2^32 scale)
+    std::vector<uint32_t> alias;      // Otherwise take this index (full columns alias themselves)
+
+public:
+    // Negative weights count as zero; all-zero weights sample uniformly
+    void build(const double* weights, int count);
+
+    int size() const { return static_cast<int>(threshold.size()); }
+    bool empty() const { return threshold.empty(); }
+
+    // Table must not be empty
+    int sample(RandomStream& random) const {
+        uint64_t bits = random.next();
+        uint32_t column = static_cast<uint32_t>(((bits >> 32) * threshold.size()) >> 32);
+        return static_cast<uint32_t>(bits) < threshold[column] ? static_cast<int>(column)
+                                                               : static_cast<int>(alias[column]);
+    }
+};
+
+#endif // ALIASTABLE_H
@@ -0,0 +1,114 @@
+#include "AllocationTracker.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<bool> trackingEnabled(false);
+std::atomic<uint64_t> allocationCounts[AllocationTracker::MAX_TAGS];
+std::atomic<uint64_t> allocationBytes[AllocationTracker::MAX_TAGS];
+
+thread_local int currentTag = AllocationTracker::UNTAGGED;
+
+} // namespace
+
+// ============================================
+// Tracker
+// ============================================
+bool AllocationTracker::isAvailable() {
+#ifdef TEMPLANTER_ALLOC_HOOK
+    return true;
+#else
+    return false;
+#endif
+}
+
+void AllocationTracker::setEnabled(bool on) {
+    trackingEnabled.store(on && isAvailable());
+}
+
+bool AllocationTracker::isEnabled() {
+    return trackingEnabled.load(std::memory_order_relaxed);
+}
+
+int AllocationTracker::enterScope(int tag) {
+    int previous = currentTag;
+    currentTag = (tag >= 0 && tag < MAX_TAGS) ? tag : UNTAGGED;
+    return previous;
+}
+
+void AllocationTracker::leaveScope(int previousTag) {
+    currentTag = previousTag;
+}
+
+AllocationTracker::Counts AllocationTracker::getCounts(int tag) {
+    Counts counts = {0, 0};
+    if (tag >= 0 && tag < MAX_TAGS) {
+        counts.allocations = allocationCounts[tag].load(std::memory_order_relaxed);
+        counts.bytes = allocationBytes[tag].load(std::memory_order_relaxed);
+    }
+    return counts;
+}
+
+AllocationTracker::Counts AllocationTracker::getTotal() {
+    Counts total = {0, 0};
+    for (int tag = 0; tag < MAX_TAGS; tag++) {
+        Counts counts = getCounts(tag);
+        total.allocations += counts.allocations;
+        total.bytes += counts.bytes;
+    }
+    return total;
+}
+
+void AllocationTracker::reset() {
+    for (int tag = 0; tag < MAX_TAGS; tag++) {
+        allocationCounts[tag].store(0);
+        allocationBytes[tag].store(0);
+    }
+}
+
+void AllocationTracker::recordAllocation(size_t bytes) {
+    if (!trackingEnabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+    allocationCounts[currentTag].fetch_add(1, std::memory_order_relaxed);
+    allocationBytes[currentTag].fetch_add(bytes, std::memory_order_relaxed);
+}
+
+// ============================================
+// Global operator new / delete hook
+// ============================================
+#ifdef TEMPLANTER_ALLOC_HOOK
+
+namespace {
+
+void* allocate(size_t bytes) {
+    AllocationTracker::recordAllocation(bytes);
+    void* memory = std::malloc(bytes != 0 ? bytes : 1);
+    if (memory == nullptr) {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void* allocateNoThrow(size_t bytes) noexcept {
+    AllocationTracker::recordAllocation(bytes);
+    return std::malloc(bytes != 0 ? bytes : 1);
+}
+
+} // namespace
+
+void* operator new(size_t bytes) { return allocate(bytes); }
+void* operator new[](size_t bytes) { return allocate(bytes); }
+void* operator new(size_t bytes, const std::nothrow_t&) noexcept { return allocateNoThrow(bytes); }
+void* operator new[](size_t bytes, const std::nothrow_t&) noexcept { return allocateNoThrow(bytes); }
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete[](void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, size_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, size_t) noexcept { std::free(memory); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept { std::free(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { std::free(memory); }
+
+#endif // TEMPLANTER_ALLOC_HOOK
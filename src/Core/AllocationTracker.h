@@ -0,0 +1,44 @@
+#ifndef ALLOCATIONTRACKER_H
+#define ALLOCATIONTRACKER_H
+
+#include <cstddef>
+#include <cstdint>
+
+// ============================================
+// ALLOCATION TRACKER
+// ============================================
+// Counts heap allocations made through global operator new, charged to
+// the calling thread's current scope tag. FrameProfiler scopes set the
+// tag to their ProfilePhase, so counts come out per subsystem and per
+// frame. The operator new hook is compiled in with TEMPLANTER_ALLOC_HOOK
+// (CMake option) and counts nothing until setEnabled(true).
+class AllocationTracker {
+public:
+    static const int MAX_TAGS = 16;
+    static const int UNTAGGED = MAX_TAGS - 1;  // Outside any profiler scope
+
+    struct Counts {
+        uint64_t allocations;
+        uint64_t bytes;
+    };
+
+    // Whether the operator new hook was built in
+    static bool isAvailable();
+
+    static void setEnabled(bool on);
+    static bool isEnabled();
+
+    // Charge this thread's allocations to tag; returns the previous tag
+    static int enterScope(int tag);
+    static void leaveScope(int previousTag);
+
+    // Running totals since the last reset()
+    static Counts getCounts(int tag);
+    static Counts getTotal();
+    static void reset();
+
+    // Called from the operator new hook
+    static void recordAllocation(size_t bytes);
+};
+
+#endif // ALLOCATIONTRACKER_H
@@ -0,0 +1,45 @@
+#ifndef CLOCK_H
+#define CLOCK_H
+
+#include <chrono>
+
+// ============================================
+// CLOCK (Abstract Interface)
+// ============================================
+// The single authoritative time source for the game loop.
+// Injected into FixedTimestep so tests and headless runs can drive time.
+class Clock {
+public:
+    virtual ~Clock() = default;
+    
+    // Monotonic time in seconds since an arbitrary epoch
+    virtual double now() const = 0;
+};
+
+// Concrete Clock: Real (monotonic) wall time
+class SteadyClock : public Clock {
+private:
+    std::chrono::steady_clock::time_point start;
+    
+public:
+    SteadyClock() : start(std::chrono::steady_clock::now()) {}
+    
+    double now() const override {
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+};
+
+// Concrete Clock: Manually advanced time (tests, replays)
+class ManualClock : public Clock {
+private:
+    double currentTime;
+    
+public:
+    ManualClock() : currentTime(0.0) {}
+    
+    double now() const override { return currentTime; }
+    void advance(double seconds) { currentTime += seconds; }
+};
+
+#endif // CLOCK_H
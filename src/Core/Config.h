@@ -2,6 +2,7 @@
 #define CONFIG_H
 
 #include <string>
+#include <cstdint>
 
 namespace Config {
     // Window Settings
@@ -22,6 +23,47 @@ namespace Config {
     const int DAY_START_HOUR = 6;   // 6 AM
     const int NIGHT_START_HOUR = 20; // 8 PM
     
+    // Simulation Loop Settings
+    const float SIM_TICK_SECONDS = 1.0f / 60.0f;  // Fixed simulation step
+    const int MAX_CATCHUP_STEPS = 5;              // Max ticks per frame before dropping time
+    const uint64_t SIM_DEFAULT_SEED = 20240917;   // Session seed unless one is given
+    
+    // Time Warp Settings
+    // Sim seconds are game minutes, so x1440 is one game day per real second
+    // (~5 steps per 60 Hz tick). Longer spans go through Simulation::advance
+    const float MAX_WARP_FACTOR = 1440.0f;
+    const float WARP_MAX_STEP_SECONDS = 5.0f;     // Largest batched step when fast-forwarding
+    
+    // Plant Event Scheduler Settings
+    const float PLANT_WHEEL_TICK_SECONDS = 1.0f;  // Timing wheel resolution
+    
+    // Parallel Plant Update Settings
+    const int SIM_WORKER_THREADS = 0;             // Threads for plant updates (0 = all cores)
+    const int PLANT_CHUNK_SIZE = 256;             // Plants per work item
+    const int PLANT_PARALLEL_MIN_BATCH = 1024;    // Smaller wake batches update serially
+    
+    // Frame Profiler Settings
+    const int PROFILER_WINDOW_FRAMES = 600;       // Rolling window for percentiles (~10s at 60 FPS)
+    const int TRACE_MAX_EVENTS = 1 << 18;         // Preallocated trace buffer (~14 MB)
+    const std::string TRACE_FILE = "trace.json";  // F4 in game writes here
+    const double METRICS_INTERVAL_SECONDS = 5.0;  // Prometheus text publish period
+    
+    // Frame Budget Settings (deferrable work spills into later frames)
+    const double FRAME_BUDGET_MS = 12.0;          // Game default, 3/4 of a 60 FPS frame (0 = off)
+    const int SNAPSHOT_SLICE_PLANTS = 1024;       // Plants serialized between budget checks
+    
+    // Plant Catalog (hot reload polls the loaded file's modification time)
+    const double CATALOG_WATCH_INTERVAL_SECONDS = 2.0;
+    
+    // Soak Run Limits (headless --soak; growth measured from the end of warm-up)
+    const int SOAK_DEFAULT_DAYS = 30;
+    const int SOAK_WARMUP_DAYS = 10;  // Until the day-end snapshot history is full
+    const int SOAK_GRID_WIDTH = 200;  // Soak grid unless --grid is given
+    const int SOAK_GRID_HEIGHT = 200;
+    const double SOAK_MAX_RSS_GROWTH_PERCENT = 20.0;
+    const double SOAK_MAX_LATENCY_DRIFT_PERCENT = 50.0;  // Median tick time
+    const long long SOAK_MAX_OBJECT_GROWTH = 1000;       // Live instances of any one type
+    
     // Economy
     const double STARTING_MONEY = 500.0;
     const double STARTING_RATING = 3.0;
@@ -32,6 +74,7 @@ namespace Config {
     const int WORKER_SKILL_TRAIN_COST[] = {0, 100, 250, 500, 1000}; // Cost to upgrade to each level
     
     // Customer Settings
+    const float CUSTOMER_SPAWN_INTERVAL = 15.0f;      // Seconds between arrivals
     const float CUSTOMER_REGULAR_WAIT_TIME = 120.0f;  // 2 minutes in seconds
     const float CUSTOMER_VIP_WAIT_TIME = 60.0f;       // 1 minute
     const float ROBBER_CHANCE = 0.05f;                // 5% chance
@@ -0,0 +1,32 @@
+#include "FixedTimestep.h"
+
+FixedTimestep::FixedTimestep(const Clock& sourceClock, float tick, int maxSteps)
+    : clock(sourceClock), tickSeconds(tick), maxCatchUpSteps(maxSteps),
+      lastTime(sourceClock.now()), accumulator(0.0),
+      totalTicks(0), droppedSeconds(0.0) {
+}
+
+int FixedTimestep::beginFrame() {
+    double now = clock.now();
+    accumulator += now - lastTime;
+    lastTime = now;
+    
+    int steps = static_cast<int>(accumulator / tickSeconds);
+    
+    // Cap catch-up work; drop the rest of the backlog
+    if (steps > maxCatchUpSteps) {
+        double excess = (steps - maxCatchUpSteps) * static_cast<double>(tickSeconds);
+        droppedSeconds += excess;
+        accumulator -= excess;
+        steps = maxCatchUpSteps;
+    }
+    
+    accumulator -= steps * static_cast<double>(tickSeconds);
+    totalTicks += steps;
+    return steps;
+}
+
+void FixedTimestep::reset() {
+    lastTime = clock.now();
+    accumulator = 0.0;
+}
@@ -0,0 +1,45 @@
+#ifndef FIXEDTIMESTEP_H
+#define FIXEDTIMESTEP_H
+
+#include "Clock.h"
+#include "Config.h"
+
+// ============================================
+// FIXED TIMESTEP
+// ============================================
+// Converts variable frame time from a Clock into a whole number of
+// fixed-size simulation ticks. Leftover time stays in the accumulator;
+// time beyond the catch-up cap is dropped so a slow frame can't snowball.
+class FixedTimestep {
+private:
+    const Clock& clock;
+    float tickSeconds;
+    int maxCatchUpSteps;
+    
+    double lastTime;
+    double accumulator;
+    
+    // Statistics
+    long long totalTicks;
+    double droppedSeconds;
+    
+public:
+    FixedTimestep(const Clock& sourceClock,
+                  float tick = Config::SIM_TICK_SECONDS,
+                  int maxSteps = Config::MAX_CATCHUP_STEPS);
+    
+    // Read the clock once and return how many ticks to run this frame
+    int beginFrame();
+    
+    // Resynchronise with the clock and discard accumulated time
+    void reset();
+    
+    // Getters
+    float getTickSeconds() const { return tickSeconds; }
+    int getMaxCatchUpSteps() const { return maxCatchUpSteps; }
+    float getAlpha() const { return static_cast<float>(accumulator / tickSeconds); }  // For render interpolation
+    long long getTotalTicks() const { return totalTicks; }
+    double getDroppedSeconds() const { return droppedSeconds; }
+};
+
+#endif // FIXEDTIMESTEP_H
@@ -0,0 +1,48 @@
+#include "FrameBudget.h"
+
+// ============================================
+// Singleton
+// ============================================
+FrameBudget* FrameBudget::instance = nullptr;
+
+FrameBudget* FrameBudget::getInstance() {
+    if (instance == nullptr) {
+        instance = new FrameBudget();
+    }
+    return instance;
+}
+
+void FrameBudget::destroyInstance() {
+    if (instance != nullptr) {
+        delete instance;
+        instance = nullptr;
+    }
+}
+
+FrameBudget::FrameBudget()
+    : budgetMs(0.0), frameStart(BudgetClock::now()), deferredThisFrame(false),
+      frameCount(0), overrunFrames(0), deferredFrames(0) {
+}
+
+// ============================================
+// Frames
+// ============================================
+void FrameBudget::beginFrame() {
+    frameStart = BudgetClock::now();
+    deferredThisFrame = false;
+}
+
+void FrameBudget::endFrame() {
+    frameCount++;
+    if (isExhausted()) {
+        overrunFrames++;
+    }
+    if (deferredThisFrame) {
+        deferredFrames++;
+    }
+}
+
+double FrameBudget::getElapsedMs() const {
+    std::chrono::duration<double, std::milli> elapsed = BudgetClock::now() - frameStart;
+    return elapsed.count();
+}
@@ -0,0 +1,58 @@
+#ifndef FRAMEBUDGET_H
+#define FRAMEBUDGET_H
+
+#include <chrono>
+#include "Config.h"
+
+// ============================================
+// FRAME BUDGET (Singleton)
+// ============================================
+// Wall-time allowance for one frame. Plant, time, worker and customer
+// updates always run; deferrable work (day-end snapshot serialization,
+// scheduler backlog draining, metrics collection, UI text rebuilds) runs
+// in slices and checks isExhausted() between them, leaving the rest for
+// later frames. A budget of 0 never runs out.
+class FrameBudget {
+private:
+    typedef std::chrono::steady_clock BudgetClock;
+
+    static FrameBudget* instance;
+
+    double budgetMs;
+    BudgetClock::time_point frameStart;
+    mutable bool deferredThisFrame;  // Set through const budget pointers
+
+    // Statistics
+    long long frameCount;
+    long long overrunFrames;   // Frames that ran past the budget
+    long long deferredFrames;  // Frames that left deferrable work for later
+
+    FrameBudget();
+
+public:
+    static FrameBudget* getInstance();
+    static void destroyInstance();
+
+    // Delete copy constructor and assignment
+    FrameBudget(const FrameBudget&) = delete;
+    FrameBudget& operator=(const FrameBudget&) = delete;
+
+    void setBudgetMs(double milliseconds) { budgetMs = milliseconds; }
+    double getBudgetMs() const { return budgetMs; }
+    bool isEnabled() const { return budgetMs > 0.0; }
+
+    void beginFrame();
+    void endFrame();
+
+    double getElapsedMs() const;
+    bool isExhausted() const { return isEnabled() && getElapsedMs() >= budgetMs; }
+
+    // Deferrable work that stopped early calls this once per slice it skips
+    void noteDeferred() const { deferredThisFrame = true; }
+
+    long long getFrameCount() const { return frameCount; }
+    long long getOverrunFrames() const { return overrunFrames; }
+    long long getDeferredFrames() const { return deferredFrames; }
+};
+
+#endif // FRAMEBUDGET_H
@@ -0,0 +1,179 @@
+#include "FrameProfiler.h"
+#include <algorithm>
+#include <iomanip>
+
+// ============================================
+// Singleton
+// ============================================
+FrameProfiler* FrameProfiler::instance = nullptr;
+
+FrameProfiler* FrameProfiler::getInstance() {
+    if (instance == nullptr) {
+        instance = new FrameProfiler();
+    }
+    return instance;
+}
+
+void FrameProfiler::destroyInstance() {
+    if (instance != nullptr) {
+        delete instance;
+        instance = nullptr;
+    }
+}
+
+FrameProfiler::FrameProfiler()
+    : scratch(Config::PROFILER_WINDOW_FRAMES), enabled(true), allocationsRecorded(false), frameCount(0) {
+    for (PhaseWindow& window : phases) {
+        window.samples.assign(Config::PROFILER_WINDOW_FRAMES, 0.0f);
+        window.allocationSamples.assign(Config::PROFILER_WINDOW_FRAMES, 0.0f);
+        window.byteSamples.assign(Config::PROFILER_WINDOW_FRAMES, 0.0f);
+    }
+    reset();
+}
+
+// ============================================
+// Recording
+// ============================================
+void FrameProfiler::beginFrame() {
+    for (PhaseWindow& window : phases) {
+        window.frameTotalMs = 0.0;
+        window.ranThisFrame = false;
+    }
+}
+
+void FrameProfiler::addSample(ProfilePhase phase, double milliseconds) {
+    PhaseWindow& window = phases[static_cast<int>(phase)];
+    window.frameTotalMs += milliseconds;
+    window.ranThisFrame = true;
+}
+
+void FrameProfiler::endFrame() {
+    if (!enabled) {
+        return;
+    }
+
+    bool countAllocations = AllocationTracker::isEnabled();
+    allocationsRecorded = allocationsRecorded || countAllocations;
+    
+    for (int i = 0; i < static_cast<int>(ProfilePhase::COUNT); i++) {
+        PhaseWindow& window = phases[i];
+        
+        AllocationTracker::Counts counts = window.lastCounts;
+        if (countAllocations) {
+            counts = AllocationTracker::getCounts(i);
+        }
+        
+        if (window.ranThisFrame) {
+            window.samples[window.next] = static_cast<float>(window.frameTotalMs);
+            window.allocationSamples[window.next] = static_cast<float>(counts.allocations - window.lastCounts.allocations);
+            window.byteSamples[window.next] = static_cast<float>(counts.bytes - window.lastCounts.bytes);
+            window.next = (window.next + 1) % Config::PROFILER_WINDOW_FRAMES;
+            window.count = std::min(window.count + 1, Config::PROFILER_WINDOW_FRAMES);
+        }
+        window.lastCounts = counts;
+    }
+    frameCount++;
+    beginFrame();
+}
+
+void FrameProfiler::reset() {
+    for (int i = 0; i < static_cast<int>(ProfilePhase::COUNT); i++) {
+        phases[i].next = 0;
+        phases[i].count = 0;
+        phases[i].lastCounts = AllocationTracker::getCounts(i);
+    }
+    frameCount = 0;
+    allocationsRecorded = false;
+    beginFrame();
+}
+
+// ============================================
+// Reporting
+// ============================================
+FrameProfiler::PhaseStats FrameProfiler::getStats(ProfilePhase phase) const {
+    const PhaseWindow& window = phases[static_cast<int>(phase)];
+    PhaseStats stats = {window.count, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    if (window.count == 0) {
+        return stats;
+    }
+
+    // Oldest samples are overwritten first, so the first count entries
+    // are exactly the window whether or not it has wrapped
+    std::copy(window.samples.begin(), window.samples.begin() + window.count, scratch.begin());
+    std::vector<float>::iterator first = scratch.begin();
+    std::vector<float>::iterator last = scratch.begin() + window.count;
+
+    double sum = 0.0;
+    for (std::vector<float>::iterator it = first; it != last; ++it) {
+        sum += *it;
+    }
+    stats.meanMs = sum / window.count;
+    
+    double allocations = 0.0;
+    double bytes = 0.0;
+    for (int i = 0; i < window.count; i++) {
+        allocations += window.allocationSamples[i];
+        bytes += window.byteSamples[i];
+        stats.maxAllocations = std::max(stats.maxAllocations, static_cast<double>(window.allocationSamples[i]));
+    }
+    stats.allocationsPerFrame = allocations / window.count;
+    stats.bytesPerFrame = bytes / window.count;
+
+    // Nearest-rank percentiles; each nth_element narrows the next search
+    int p50 = (window.count - 1) * 50 / 100;
+    int p95 = (window.count - 1) * 95 / 100;
+    int p99 = (window.count - 1) * 99 / 100;
+    std::nth_element(first, first + p50, last);
+    stats.p50Ms = first[p50];
+    std::nth_element(first + p50, first + p95, last);
+    stats.p95Ms = first[p95];
+    std::nth_element(first + p95, first + p99, last);
+    stats.p99Ms = first[p99];
+    stats.maxMs = *std::max_element(first + p99, last);
+    return stats;
+}
+
+const char* FrameProfiler::getPhaseName(ProfilePhase phase) {
+    switch (phase) {
+        case ProfilePhase::FRAME:     return "frame";
+        case ProfilePhase::INPUT:     return "input";
+        case ProfilePhase::UPDATE:    return "update";
+        case ProfilePhase::PLANTS:    return "plants";
+        case ProfilePhase::WORKERS:   return "workers";
+        case ProfilePhase::CUSTOMERS: return "customers";
+        case ProfilePhase::SPAWN:     return "spawn";
+        case ProfilePhase::DAY_END:   return "day_end";
+        case ProfilePhase::RENDER:    return "render";
+        case ProfilePhase::COUNT:     break;
+    }
+    return "unknown";
+}
+
+void FrameProfiler::writeCsv(std::ostream& out) const {
+    std::ios::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+
+    bool allocations = allocationsRecorded;
+    out << "phase,samples,mean_ms,p50_ms,p95_ms,p99_ms,max_ms";
+    if (allocations) {
+        out << ",allocs_per_frame,bytes_per_frame,max_allocs";
+    }
+    out << "\n";
+    out << std::fixed << std::setprecision(4);
+    for (int i = 0; i < static_cast<int>(ProfilePhase::COUNT); i++) {
+        ProfilePhase phase = static_cast<ProfilePhase>(i);
+        PhaseStats stats = getStats(phase);
+        if (stats.samples == 0) {
+            continue;
+        }
+        out << getPhaseName(phase) << "," << stats.samples << "," << stats.meanMs << ","
+            << stats.p50Ms << "," << stats.p95Ms << "," << stats.p99Ms << "," << stats.maxMs;
+        if (allocations) {
+            out << "," << stats.allocationsPerFrame << "," << stats.bytesPerFrame << "," << stats.maxAllocations;
+        }
+        out << "\n";
+    }
+
+    out.flags(flags);
+    out.precision(precision);
+}
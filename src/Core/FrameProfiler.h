@@ -0,0 +1,145 @@
+#ifndef FRAMEPROFILER_H
+#define FRAMEPROFILER_H
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+#include "Config.h"
+#include "Tracer.h"
+#include "AllocationTracker.h"
+
+// Timed sections of a frame (nested phases are also counted in their parent)
+enum class ProfilePhase : uint8_t {
+    FRAME,       // Whole frame / headless tick
+    INPUT,       // GameManager::handleInput
+    UPDATE,      // All simulation ticks in the frame
+    PLANTS,      // Simulation::updatePlants
+    WORKERS,     // Simulation::updateWorkers
+    CUSTOMERS,   // Simulation::processCustomers
+    SPAWN,       // Simulation::spawnCustomers
+    DAY_END,     // Simulation::checkDayEnd
+    RENDER,      // GameManager::render
+    COUNT
+};
+
+static_assert(static_cast<int>(ProfilePhase::COUNT) < AllocationTracker::UNTAGGED,
+              "profiler phases double as allocation tags");
+
+// ============================================
+// FRAME PROFILER (Singleton)
+// ============================================
+// Scoped timers add their time to the current frame; endFrame() pushes
+// each phase's frame total into a rolling window of the last
+// PROFILER_WINDOW_FRAMES frames, from which percentiles are computed on
+// demand. Phases that did not run in a frame record no sample.
+// While AllocationTracker is enabled each sample also records the heap
+// allocations charged to that phase (innermost scope wins).
+// Timers are meant for the main thread (the plant thread pool runs
+// inside PLANTS).
+class FrameProfiler {
+public:
+    struct PhaseStats {
+        int samples;
+        double meanMs;
+        double p50Ms;
+        double p95Ms;
+        double p99Ms;
+        double maxMs;
+        double allocationsPerFrame;  // Mean; 0 unless AllocationTracker is enabled
+        double bytesPerFrame;
+        double maxAllocations;
+    };
+
+private:
+    typedef std::chrono::steady_clock ProfileClock;
+
+    static FrameProfiler* instance;
+
+    struct PhaseWindow {
+        std::vector<float> samples;  // Milliseconds, ring of PROFILER_WINDOW_FRAMES
+        std::vector<float> allocationSamples;  // Allocations per frame, same ring
+        std::vector<float> byteSamples;        // Bytes per frame, same ring
+        AllocationTracker::Counts lastCounts;  // Tracker totals at the previous endFrame
+        int next;                    // Ring write position
+        int count;                   // Valid samples (<= window size)
+        double frameTotalMs;         // Accumulated in the current frame
+        bool ranThisFrame;
+    };
+
+    PhaseWindow phases[static_cast<int>(ProfilePhase::COUNT)];
+    mutable std::vector<float> scratch;  // Reused for percentile selection
+    bool enabled;
+    bool allocationsRecorded;  // Some frame since reset() ran with the tracker on
+    long long frameCount;
+
+    FrameProfiler();
+
+public:
+    static FrameProfiler* getInstance();
+    static void destroyInstance();
+
+    // Delete copy constructor and assignment
+    FrameProfiler(const FrameProfiler&) = delete;
+    FrameProfiler& operator=(const FrameProfiler&) = delete;
+
+    void setEnabled(bool on) { enabled = on; }
+    bool isEnabled() const { return enabled; }
+
+    void beginFrame();
+    void endFrame();
+    void addSample(ProfilePhase phase, double milliseconds);
+    void reset();
+
+    PhaseStats getStats(ProfilePhase phase) const;
+    long long getFrameCount() const { return frameCount; }
+    static const char* getPhaseName(ProfilePhase phase);
+
+    // One row per phase that has samples; allocation columns are added
+    // when allocations were recorded
+    void writeCsv(std::ostream& out) const;
+
+    // ============================================
+    // SCOPED TIMER
+    // ============================================
+    // FrameProfiler::Scope scope(ProfilePhase::PLANTS);
+    // Also emits a "tick" duration event while the Tracer is recording.
+    class Scope {
+    private:
+        ProfilePhase phase;
+        ProfileClock::time_point start;
+        bool profiling;
+        bool tracing;
+        int previousAllocationTag;
+
+    public:
+        explicit Scope(ProfilePhase p)
+            : phase(p), profiling(FrameProfiler::getInstance()->isEnabled()),
+              tracing(Tracer::getInstance()->isEnabled()),
+              previousAllocationTag(AllocationTracker::enterScope(static_cast<int>(p))) {
+            if (profiling || tracing) {
+                start = ProfileClock::now();
+            }
+        }
+
+        ~Scope() {
+            AllocationTracker::leaveScope(previousAllocationTag);
+            if (!profiling && !tracing) {
+                return;
+            }
+            ProfileClock::time_point end = ProfileClock::now();
+            if (profiling) {
+                std::chrono::duration<double, std::milli> elapsed = end - start;
+                FrameProfiler::getInstance()->addSample(phase, elapsed.count());
+            }
+            if (tracing) {
+                Tracer::getInstance()->complete(getPhaseName(phase), "tick", start, end);
+            }
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+};
+
+#endif // FRAMEPROFILER_H
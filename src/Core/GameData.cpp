@@ -1,5 +1,5 @@
 #include "GameData.h"
-#include <iostream>
+#include "Logger.h"
 #include <sstream>
 #include <iomanip>
 
@@ -21,18 +21,39 @@ void GameData::generateTimestamp() {
     timestamp = ss.str();
 }
 
+size_t GameData::getApproxBytes() const {
+    size_t bytes = sizeof(GameData) + saveName.capacity() + timestamp.capacity();
+    bytes += greenhouse.plants.capacity() * sizeof(PlantData);
+    for (const PlantData& plant : greenhouse.plants) {
+        bytes += plant.type.capacity() + plant.state.capacity();
+    }
+    bytes += workers.capacity() * sizeof(WorkerData);
+    for (const WorkerData& worker : workers) {
+        bytes += worker.name.capacity() + worker.currentRole.capacity();
+    }
+    bytes += inventory.items.capacity() * sizeof(InventoryItemData);
+    for (const InventoryItemData& item : inventory.items) {
+        bytes += item.itemType.capacity() + item.itemName.capacity();
+    }
+    bytes += statistics.achievementsUnlocked.capacity() * sizeof(std::string);
+    for (const std::string& achievement : statistics.achievementsUnlocked) {
+        bytes += achievement.capacity();
+    }
+    return bytes;
+}
+
 void GameData::printSummary() const {
-    std::cout << "\n╔════════════════════════════════════════╗" << std::endl;
-    std::cout << "║         GAME STATE SNAPSHOT            ║" << std::endl;
-    std::cout << "╚════════════════════════════════════════╝" << std::endl;
-    std::cout << "Name: " << saveName << std::endl;
-    std::cout << "Time: " << timestamp << std::endl;
-    std::cout << "\nDay " << time.day << " | " 
-              << time.hour << ":" << std::setfill('0') << std::setw(2) << time.minute << std::endl;
-    std::cout << "Money: $" << economy.currency << " | Rating: " << economy.rating << "/5" << std::endl;
-    std::cout << "Greenhouse: " << greenhouse.width << "x" << greenhouse.height 
-              << " (" << greenhouse.plants.size() << " plants)" << std::endl;
-    std::cout << "Workers: " << workers.size() << std::endl;
-    std::cout << "Stats: " << statistics.totalPlantsGrown << " grown, "
-              << statistics.totalCustomersServed << " customers served" << std::endl;
+    LOG_INFO(SAVE, "\n╔════════════════════════════════════════╗");
+    LOG_INFO(SAVE, "║         GAME STATE SNAPSHOT            ║");
+    LOG_INFO(SAVE, "╚════════════════════════════════════════╝");
+    LOG_INFO(SAVE, "Name: " << saveName);
+    LOG_INFO(SAVE, "Time: " << timestamp);
+    LOG_INFO(SAVE, "\nDay " << time.day << " | " 
+                   << time.hour << ":" << std::setfill('0') << std::setw(2) << time.minute);
+    LOG_INFO(SAVE, "Money: $" << economy.currency << " | Rating: " << economy.rating << "/5");
+    LOG_INFO(SAVE, "Greenhouse: " << greenhouse.width << "x" << greenhouse.height 
+                   << " (" << greenhouse.plants.size() << " plants)");
+    LOG_INFO(SAVE, "Workers: " << workers.size());
+    LOG_INFO(SAVE, "Stats: " << statistics.totalPlantsGrown << " grown, "
+                   << statistics.totalCustomersServed << " customers served");
 }
\ No newline at end of file
@@ -16,10 +16,10 @@ struct PlantData {
     std::string state;
     float growthProgress;
     int waterLevel;
-    std::time_t lastWateredTime;
+    double lastWateredTime;      // Game minutes (TimeManager::getGameMinutes)
     
     PlantData() : id(0), posX(0), posY(0), growthProgress(0.0f), 
-                  waterLevel(100), lastWateredTime(0) {}
+                  waterLevel(100), lastWateredTime(0.0) {}
 };
 
 struct WorkerData {
@@ -118,6 +118,10 @@ public:
     void generateSaveName();
     void generateTimestamp();
     void printSummary() const;
+    
+    // Heap + inline bytes held by this snapshot (approximate: ignores
+    // allocator overhead and small-string buffers)
+    size_t getApproxBytes() const;
 };
 
 #endif // GAMEDATA_H
\ No newline at end of file
@@ -2,65 +2,34 @@
 #include "Greenhouse/Plant.h"
 #include "Greenhouse/PlantTypes.h"
 #include "Staff/Worker.h"
-#include "Patterns/Decorator/WorkerRole.h"
-#include "Customer/Customer.h"
-#include "Patterns/Mediator/WorkScheduler.h"
-#include "Patterns/Composite/StorageComponent.h"
-#include "Patterns/Iterator/InventoryIterator.h"
-#include "Patterns/Factory/CustomerFactory.h"
-#include <iostream>
-
-GameManager::GameManager()
+#include "FixedTimestep.h"
+#include "FrameProfiler.h"
+#include "FrameBudget.h"
+#include "Tracer.h"
+#include "AllocationTracker.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cstdio>
+
+GameManager::GameManager(const Clock* gameClock)
     : window(nullptr), currentState(GameState::MAIN_MENU),
-      currency(500.0), customerRating(3.0),
-      greenhouseWidth(3), greenhouseHeight(3),
-      selectedPlant(nullptr), selectedWorker(nullptr),
-      selectedTileX(-1), selectedTileY(-1),
-      customerSpawnTimer(0.0f), dayTimer(0.0f),
-      totalPlantsGrown(0), totalCustomersServed(0), totalMoneyEarned(0.0) {
-    
-    // Initialize singletons
-    timeManager = TimeManager::getInstance();
-    saveManager = SaveManager::getInstance();
-    
-    // Initialize managers
-    workScheduler = new WorkScheduler();
-    caretaker = new Caretaker(10);  // Max 10 snapshots
+      simulation(nullptr), clock(gameClock ? gameClock : &defaultClock),
+      selectedWorker(nullptr),
+      selectedTileX(-1), selectedTileY(-1), showProfiler(false) {
     
-    // Initialize storage
-    mainStorage = new StorageContainer("Main Warehouse", 1000);
-    inventory = new Inventory();
+    simulation = new Simulation(Config::INITIAL_GRID_WIDTH, Config::INITIAL_GRID_HEIGHT);
+    FrameBudget::getInstance()->setBudgetMs(Config::FRAME_BUDGET_MS);
     
     initializeWindow();
 }
 
 GameManager::~GameManager() {
-    // Clean up plants
-    for (auto* plant : plants) {
-        delete plant;
-    }
-    
-    // Clean up workers
-    for (auto* worker : workers) {
-        delete worker;
-    }
-    
-    // Clean up customers
-    while (!customerQueue.empty()) {
-        delete customerQueue.front();
-        customerQueue.pop();
+    if (recorder.isOpen()) {
+        simulation->setRecorder(nullptr);
+        recorder.close(simulation->getStateHash());
     }
-    
-    delete workScheduler;
-    delete mainStorage;
-    delete inventory;
-    delete caretaker;
+    delete simulation;
     delete window;
-    
-    // Destroy singletons
-    TimeManager::destroyInstance();
-    SaveManager::destroyInstance();
-    PlantTypeDatabase::destroyInstance();
 }
 
 void GameManager::initializeWindow() {
@@ -72,59 +41,47 @@ void GameManager::initializeWindow() {
     
     // Try to load font (optional - game works without it)
     if (!font.loadFromFile(Config::FONTS_PATH + "arial.ttf")) {
-        std::cout << "⚠️  Warning: Could not load font (will use shapes instead)" << std::endl;
-        std::cout << "   Game will work fine, text just won't display." << std::endl;
+        LOG_WARN(UI, "⚠️  Warning: Could not load font (will use shapes instead)");
+        LOG_INFO(UI, "   Game will work fine, text just won't display.");
     } else {
-        std::cout << "✓ Font loaded successfully" << std::endl;
+        LOG_INFO(UI, "✓ Font loaded successfully");
     }
 }
 
-void GameManager::initializeGame() {
-    std::cout << "\n========================================" << std::endl;
-    std::cout << "     🌱 TEMPLANTER - New Game 🌱" << std::endl;
-    std::cout << "========================================\n" << std::endl;
-    
-    // Initialize greenhouse grid
-    plants.resize(greenhouseWidth * greenhouseHeight, nullptr);
-    
-    // Give player some starting resources
-    currency = Config::STARTING_MONEY;
-    customerRating = Config::STARTING_RATING;
-    
-    // Add starting items to inventory
-    inventory->addItem("Tomato Seeds", "seed", 10, 8);
-    inventory->addItem("Basil Seeds", "seed", 10, 5);
-    inventory->addItem("Nutrient Pack", "nutrient", 3, 50);
-    
-    // Hire one starting worker
-    Worker* starter = new Worker(1, "Bob");
-    starter->addRole(new WatererRole(starter));
-    workers.push_back(starter);
-    workScheduler->registerWorker(starter);
-    
-    std::cout << "✓ Starting balance: $" << currency << std::endl;
-    std::cout << "✓ Starting rating: " << customerRating << " stars" << std::endl;
-    std::cout << "✓ Greenhouse size: " << greenhouseWidth << "x" << greenhouseHeight << std::endl;
-    std::cout << "✓ Starting worker: " << starter->getName() << std::endl;
-    std::cout << "\nGame initialized! Press SPACE to start." << std::endl;
-    
-    // Create initial snapshot
-    createSnapshot();
-}
-
 void GameManager::run() {
-    sf::Clock clock;
+    // Fixed-timestep loop: simulation ticks at a constant rate,
+    // rendering runs once per frame independent of the tick rate
+    FixedTimestep timestep(*clock);
+    FrameProfiler* profiler = FrameProfiler::getInstance();
+    FrameBudget* budget = FrameBudget::getInstance();
     
     while (window->isOpen()) {
-        float deltaTime = clock.restart().asSeconds();
-        
-        handleInput();
-        
-        if (currentState == GameState::PLAYING) {
-            update(deltaTime);
+        budget->beginFrame();
+        profiler->beginFrame();
+        {
+            FrameProfiler::Scope frameScope(ProfilePhase::FRAME);
+            {
+                FrameProfiler::Scope scope(ProfilePhase::INPUT);
+                handleInput();
+            }
+            
+            int steps = timestep.beginFrame();
+            
+            if (currentState == GameState::PLAYING) {
+                FrameProfiler::Scope scope(ProfilePhase::UPDATE);
+                for (int i = 0; i < steps; i++) {
+                    simulation->update(timestep.getTickSeconds());
+                }
+                if (steps > 0) {
+                    syncSelectedPlant();
+                }
+            }
+            
+            FrameProfiler::Scope scope(ProfilePhase::RENDER);
+            render();
         }
-        
-        render();
+        profiler->endFrame();
+        budget->endFrame();
     }
 }
 
@@ -176,7 +133,46 @@ void GameManager::handleInput() {
                     
                 case sf::Keyboard::P:
                     if (currentState == GameState::PLAYING) {
-                        timeManager->togglePause();
+                        simulation->getTimeManager()->togglePause();
+                    }
+                    break;
+                    
+                case sf::Keyboard::Equal:
+                    // Time warp: double speed
+                    if (currentState == GameState::PLAYING) {
+                        simulation->setWarpFactor(simulation->getWarpFactor() * 2.0f);
+                        LOG_INFO(UI, "⏩ Time warp: x" << simulation->getWarpFactor());
+                    }
+                    break;
+                    
+                case sf::Keyboard::F3:
+                    showProfiler = !showProfiler;
+                    AllocationTracker::setEnabled(showProfiler);  // Only pay for counting while visible
+                    break;
+                    
+                case sf::Keyboard::F4: {
+                    // Start a trace, or stop and write it
+                    Tracer* tracer = Tracer::getInstance();
+                    if (!tracer->isEnabled()) {
+                        tracer->start(Config::TRACE_MAX_EVENTS);
+                        LOG_INFO(UI, "⏺️  Tracing started");
+                    } else {
+                        tracer->stop();
+                        if (tracer->save(Config::TRACE_FILE)) {
+                            LOG_INFO(UI, "⏹️  Trace written to " << Config::TRACE_FILE
+                                         << " (" << tracer->getEventCount() << " events)");
+                        } else {
+                            LOG_WARN(UI, "❌ Could not write " << Config::TRACE_FILE);
+                        }
+                    }
+                    break;
+                }
+                    
+                case sf::Keyboard::Hyphen:
+                    // Time warp: halve speed (never below normal)
+                    if (currentState == GameState::PLAYING) {
+                        simulation->setWarpFactor(std::max(1.0f, simulation->getWarpFactor() * 0.5f));
+                        LOG_INFO(UI, "⏪ Time warp: x" << simulation->getWarpFactor());
                     }
                     break;
                     
@@ -194,46 +190,19 @@ void GameManager::handleInput() {
                 int tileX = (mouseX - 50) / Config::TILE_SIZE;
                 int tileY = (mouseY - 50) / Config::TILE_SIZE;
                 
-                if (tileX >= 0 && tileX < greenhouseWidth && 
-                    tileY >= 0 && tileY < greenhouseHeight) {
+                if (tileX >= 0 && tileX < simulation->getGreenhouseWidth() && 
+                    tileY >= 0 && tileY < simulation->getGreenhouseHeight()) {
                     selectedTileX = tileX;
                     selectedTileY = tileY;
+                    syncSelectedPlant();
                     
-                    int index = tileY * greenhouseWidth + tileX;
-                    selectedPlant = plants[index];
-                    
-                    std::cout << "Selected tile (" << tileX << ", " << tileY << ")" << std::endl;
+                    LOG_INFO(UI, "Selected tile (" << tileX << ", " << tileY << ")");
                 }
             }
         }
     }
 }
 
-void GameManager::update(float deltaTime) {
-    // Update time
-    timeManager->update();
-    
-    // Update timers
-    customerSpawnTimer += deltaTime;
-    dayTimer += deltaTime;
-    
-    // Update game systems
-    updatePlants(deltaTime);
-    updateWorkers(deltaTime);
-    processCustomers(deltaTime);
-    
-    // Spawn customers periodically
-    if (customerSpawnTimer >= 15.0f) {  // Every 15 seconds
-        spawnCustomer();
-        customerSpawnTimer = 0.0f;
-    }
-    
-    // Check for day end
-    if (timeManager->getCurrentHour() == 0 && timeManager->getCurrentMinute() == 0) {
-        checkDayEnd();
-    }
-}
-
 void GameManager::render() {
     window->clear(sf::Color(34, 139, 34));  // Forest green background
     
@@ -260,29 +229,33 @@ void GameManager::render() {
 
 void GameManager::drawGreenhouse() {
     // Draw grid
-    for (int y = 0; y < greenhouseHeight; y++) {
-        for (int x = 0; x < greenhouseWidth; x++) {
+    for (int y = 0; y < simulation->getGreenhouseHeight(); y++) {
+        for (int x = 0; x < simulation->getGreenhouseWidth(); x++) {
             sf::RectangleShape tile(sf::Vector2f(Config::TILE_SIZE - 2, Config::TILE_SIZE - 2));
             tile.setPosition(50 + x * Config::TILE_SIZE, 50 + y * Config::TILE_SIZE);
             
-            int index = y * greenhouseWidth + x;
-            Plant* plant = plants[index];
+            Plant* plant = simulation->getPlantAt(x, y);
             
             // Color based on plant state
             if (plant == nullptr) {
                 tile.setFillColor(sf::Color(139, 90, 43));  // Brown dirt
             } else {
-                std::string state = plant->getStateName();
-                if (state == "Seed") {
-                    tile.setFillColor(sf::Color(160, 82, 45));  // Light brown
-                } else if (state == "Growing") {
-                    tile.setFillColor(sf::Color(34, 139, 34));  // Green
-                } else if (state == "Ripe") {
-                    tile.setFillColor(sf::Color(255, 215, 0));  // Gold
-                } else if (state == "Decaying") {
-                    tile.setFillColor(sf::Color(139, 69, 19));  // Dark brown
-                } else {
-                    tile.setFillColor(sf::Color(64, 64, 64));  // Gray (dead)
+                switch (plant->getStateId()) {
+                    case PlantStateId::SEED:
+                        tile.setFillColor(sf::Color(160, 82, 45));  // Light brown
+                        break;
+                    case PlantStateId::GROWING:
+                        tile.setFillColor(sf::Color(34, 139, 34));  // Green
+                        break;
+                    case PlantStateId::RIPE:
+                        tile.setFillColor(sf::Color(255, 215, 0));  // Gold
+                        break;
+                    case PlantStateId::DECAYING:
+                        tile.setFillColor(sf::Color(139, 69, 19));  // Dark brown
+                        break;
+                    default:
+                        tile.setFillColor(sf::Color(64, 64, 64));  // Gray (dead)
+                        break;
                 }
             }
             
@@ -306,26 +279,89 @@ void GameManager::drawUI() {
     
     // Draw text (simplified - using shapes for now since font might not load)
     if (font.getInfo().family != "") {
-        sf::Text infoText;
-        infoText.setFont(font);
-        infoText.setCharacterSize(16);
-        infoText.setFillColor(sf::Color::White);
+        sf::Text text;
+        text.setFont(font);
+        text.setCharacterSize(16);
+        text.setFillColor(sf::Color::White);
         
-        std::string info = "Day " + std::to_string(timeManager->getCurrentDay()) + 
-                          " | " + timeManager->getTimeString() +
-                          " | $" + std::to_string(static_cast<int>(currency)) +
-                          " | Rating: " + std::to_string(static_cast<int>(customerRating)) + "/5" +
-                          " | Snapshots: " + std::to_string(caretaker->getSnapshotCount());
+        if (canRebuildText(infoText)) {
+            TimeManager* timeManager = simulation->getTimeManager();
+            infoText = "Day " + std::to_string(timeManager->getCurrentDay()) + 
+                       " | " + timeManager->getTimeString() +
+                       " | $" + std::to_string(static_cast<int>(simulation->getCurrency())) +
+                       " | Rating: " + std::to_string(static_cast<int>(simulation->getRating())) + "/5" +
+                       " | Snapshots: " + std::to_string(simulation->getSnapshotCount()) +
+                       " | Speed: x" + std::to_string(static_cast<int>(simulation->getWarpFactor()));
+        }
         
-        infoText.setString(info);
-        infoText.setPosition(10, 10);
-        window->draw(infoText);
+        text.setString(infoText);
+        text.setPosition(10, 10);
+        window->draw(text);
     }
     
-    // Draw selected plant info if any
+    // Draw selected plant info if any (synced by syncSelectedPlant)
+    Plant* selectedPlant = simulation->getPlantAt(selectedTileX, selectedTileY);
     if (selectedPlant != nullptr) {
         drawPlantInfo(selectedPlant);
     }
+    
+    if (showProfiler) {
+        drawProfilerOverlay();
+    }
+}
+
+void GameManager::syncSelectedPlant() {
+    // Catch the selected plant up so the info panel shows current values.
+    // Only on selection change and after ticks: rendering stays read-only
+    if (selectedTileX >= 0 && selectedTileY >= 0) {
+        simulation->syncPlantAt(selectedTileX, selectedTileY);
+    }
+}
+
+void GameManager::drawProfilerOverlay() {
+    const int phaseCount = static_cast<int>(ProfilePhase::COUNT);
+    sf::RectangleShape panel(sf::Vector2f(440, 30 + 18 * phaseCount));
+    panel.setPosition(10, Config::WINDOW_HEIGHT - 40 - 18 * phaseCount);
+    panel.setFillColor(sf::Color(0, 0, 0, 180));
+    window->draw(panel);
+    
+    if (font.getInfo().family == "") {
+        return;
+    }
+    
+    // Percentiles sort every phase's window; skip them in busy frames
+    if (canRebuildText(profilerReport)) {
+        FrameProfiler* profiler = FrameProfiler::getInstance();
+        char line[96];
+        profilerReport = "phase       p50    p95    p99    max (ms)  allocs\n";
+        for (int i = 0; i < phaseCount; i++) {
+            ProfilePhase phase = static_cast<ProfilePhase>(i);
+            FrameProfiler::PhaseStats stats = profiler->getStats(phase);
+            if (stats.samples == 0) {
+                continue;
+            }
+            std::snprintf(line, sizeof(line), "%-10s %6.2f %6.2f %6.2f %6.2f %12.1f\n", FrameProfiler::getPhaseName(phase),
+                          stats.p50Ms, stats.p95Ms, stats.p99Ms, stats.maxMs, stats.allocationsPerFrame);
+            profilerReport += line;
+        }
+    }
+    
+    sf::Text text;
+    text.setFont(font);
+    text.setCharacterSize(13);
+    text.setFillColor(sf::Color::White);
+    text.setString(profilerReport);
+    text.setPosition(18, Config::WINDOW_HEIGHT - 34 - 18 * phaseCount);
+    window->draw(text);
+}
+
+bool GameManager::canRebuildText(const std::string& cached) const {
+    const FrameBudget* budget = FrameBudget::getInstance();
+    if (cached.empty() || !budget->isExhausted()) {
+        return true;
+    }
+    budget->noteDeferred();
+    return false;
 }
 
 void GameManager::drawPlantInfo(Plant* plant) {
@@ -402,325 +438,52 @@ void GameManager::drawPauseMenu() {
         helpText.setFont(font);
         helpText.setCharacterSize(16);
         helpText.setFillColor(sf::Color::White);
-        helpText.setString("Ctrl+S: Save Snapshot\nCtrl+L: List Snapshots\nCtrl+U: Undo\nESC: Resume");
+        helpText.setString("Ctrl+S: Save Snapshot\nCtrl+L: List Snapshots\nCtrl+U: Undo\n+/-: Time Warp\nESC: Resume");
         helpText.setPosition(Config::WINDOW_WIDTH / 2 - 100, Config::WINDOW_HEIGHT / 2 + 50);
         window->draw(helpText);
     }
 }
 
 void GameManager::startNewGame() {
-    std::cout << "\n🌱 Starting new game..." << std::endl;
-    initializeGame();
+    LOG_INFO(UI, "\n🌱 Starting new game...");
+    simulation->initialize();
+    
+    if (!recordPath.empty() && !recorder.isOpen()) {
+        if (recorder.open(recordPath, simulation->getGreenhouseWidth(), simulation->getGreenhouseHeight(),
+                          simulation->getSeed())) {
+            simulation->setRecorder(&recorder);
+            LOG_INFO(UI, "⏺️  Recording session to " << recordPath);
+        } else {
+            LOG_WARN(UI, "❌ Could not write " << recordPath);
+        }
+    }
+    LOG_INFO(UI, "\nGame initialized! Press SPACE to start.");
     currentState = GameState::PLAYING;
 }
 
 void GameManager::loadGame(const std::string& slotName) {
-    std::cout << "Loading game from " << slotName << "..." << std::endl;
+    LOG_INFO(UI, "Loading game from " << slotName << "...");
     // Not implemented - using snapshots instead
     currentState = GameState::PLAYING;
 }
 
 void GameManager::saveGame(const std::string& slotName) {
-    std::cout << "💾 Saving game to " << slotName << "..." << std::endl;
+    LOG_INFO(UI, "💾 Saving game to " << slotName << "...");
     // Not implemented - using snapshots instead
 }
 
 void GameManager::pauseGame() {
     currentState = GameState::PAUSED;
-    timeManager->pause();
-    std::cout << "⏸️  Game paused" << std::endl;
+    simulation->getTimeManager()->pause();
+    LOG_INFO(UI, "⏸️  Game paused");
 }
 
 void GameManager::resumeGame() {
     currentState = GameState::PLAYING;
-    timeManager->resume();
-    std::cout << "▶️  Game resumed" << std::endl;
+    simulation->getTimeManager()->resume();
+    LOG_INFO(UI, "▶️  Game resumed");
 }
 
 void GameManager::quitGame() {
     window->close();
 }
-
-// ============================================
-// MEMENTO PATTERN: ORIGINATOR METHODS
-// ============================================
-
-void GameManager::createSnapshot() {
-    // Create GameData from current state
-    GameData data;
-    
-    // Time
-    data.time = TimeData(
-        timeManager->getCurrentDay(), 
-        timeManager->getCurrentHour(), 
-        timeManager->getCurrentMinute()
-    );
-    
-    // Economy
-    data.economy = EconomyData(currency, customerRating);
-    
-    // Greenhouse
-    data.greenhouse = GreenhouseData(greenhouseWidth, greenhouseHeight);
-    
-    // Serialize plants
-    for (Plant* plant : plants) {
-        if (plant != nullptr) {
-            data.greenhouse.plants.push_back(plant->serialize());
-        }
-    }
-    
-    // Serialize workers
-    for (Worker* worker : workers) {
-        data.workers.push_back(worker->serialize());
-    }
-    
-    // Statistics
-    data.statistics.totalPlantsGrown = totalPlantsGrown;
-    data.statistics.totalCustomersServed = totalCustomersServed;
-    data.statistics.totalMoneyEarned = totalMoneyEarned;
-    
-    data.generateSaveName();
-    data.generateTimestamp();
-    
-    // Create memento and save to caretaker
-    GameMemento memento(data);
-    caretaker->saveMemento(memento);
-    
-    std::cout << "📸 Game snapshot created: " << data.saveName << std::endl;
-}
-
-void GameManager::restoreSnapshot(int index) {
-    try {
-        GameMemento memento = caretaker->getMemento(index);
-        const GameData& data = memento.getState();
-        
-        std::cout << "\n📂 Restoring snapshot: " << data.saveName << std::endl;
-        
-        // Restore economy
-        currency = data.economy.currency;
-        customerRating = data.economy.rating;
-        
-        // Restore time
-        timeManager->setDay(data.time.day);
-        timeManager->setTime(data.time.hour, data.time.minute);
-        
-        // Clear and restore plants
-        for (Plant* plant : plants) {
-            delete plant;
-        }
-        plants.clear();
-        plants.resize(greenhouseWidth * greenhouseHeight, nullptr);
-        
-        for (const PlantData& pd : data.greenhouse.plants) {
-            int index = pd.posY * greenhouseWidth + pd.posX;
-            if (index >= 0 && index < static_cast<int>(plants.size())) {
-                plants[index] = Plant::deserialize(pd);
-            }
-        }
-        
-        // Clear and restore workers
-        for (Worker* worker : workers) {
-            delete worker;
-        }
-        workers.clear();
-        
-        for (const WorkerData& wd : data.workers) {
-            Worker* worker = Worker::deserialize(wd);
-            workers.push_back(worker);
-            workScheduler->registerWorker(worker);
-        }
-        
-        // Restore statistics
-        totalPlantsGrown = data.statistics.totalPlantsGrown;
-        totalCustomersServed = data.statistics.totalCustomersServed;
-        totalMoneyEarned = data.statistics.totalMoneyEarned;
-        
-        std::cout << "✅ Snapshot restored successfully!" << std::endl;
-        data.printSummary();
-        
-    } catch (const std::exception& e) {
-        std::cerr << "❌ Failed to restore snapshot: " << e.what() << std::endl;
-    }
-}
-
-void GameManager::undoToLastSnapshot() {
-    try {
-        GameMemento memento = caretaker->undo();
-        std::cout << "\n⏪ Undoing to previous state..." << std::endl;
-        
-        // Get the new "current" state after undo
-        int newIndex = caretaker->getSnapshotCount() - 1;
-        restoreSnapshot(newIndex);
-        
-    } catch (const std::exception& e) {
-        std::cerr << "❌ Cannot undo: " << e.what() << std::endl;
-    }
-}
-
-void GameManager::listSnapshots() const {
-    caretaker->listSnapshots();
-}
-
-// ============================================
-// PLAYER ACTIONS
-// ============================================
-
-bool GameManager::plantSeed(PlantType type, int x, int y) {
-    if (x < 0 || x >= greenhouseWidth || y < 0 || y >= greenhouseHeight) {
-        return false;
-    }
-    
-    int index = y * greenhouseWidth + x;
-    if (plants[index] != nullptr) {
-        std::cout << "❌ Tile already occupied!" << std::endl;
-        return false;
-    }
-    
-    PlantTypeDatabase* db = PlantTypeDatabase::getInstance();
-    const PlantTypeInfo& info = db->getPlantInfo(type);
-    
-    if (currency < info.seedCost) {
-        std::cout << "❌ Not enough money! Need $" << info.seedCost << std::endl;
-        return false;
-    }
-    
-    currency -= info.seedCost;
-    
-    int plantId = static_cast<int>(plants.size());
-    Plant* newPlant = new Plant(plantId, type, x, y);
-    plants[index] = newPlant;
-    
-    // Register plant with work scheduler as observer
-    newPlant->addObserver(workScheduler);
-    
-    std::cout << "✅ Planted " << info.name << " at (" << x << ", " << y << ")" << std::endl;
-    return true;
-}
-
-bool GameManager::waterPlant(int x, int y) {
-    if (x < 0 || x >= greenhouseWidth || y < 0 || y >= greenhouseHeight) {
-        return false;
-    }
-    
-    int index = y * greenhouseWidth + x;
-    Plant* plant = plants[index];
-    
-    if (plant == nullptr) {
-        std::cout << "❌ No plant at this location!" << std::endl;
-        return false;
-    }
-    
-    plant->water();
-    std::cout << "💧 Watered " << plant->getPlantTypeInfo().name << std::endl;
-    return true;
-}
-
-bool GameManager::harvestPlant(int x, int y) {
-    if (x < 0 || x >= greenhouseWidth || y < 0 || y >= greenhouseHeight) {
-        return false;
-    }
-    
-    int index = y * greenhouseWidth + x;
-    Plant* plant = plants[index];
-    
-    if (plant == nullptr) {
-        std::cout << "❌ No plant at this location!" << std::endl;
-        return false;
-    }
-    
-    if (!plant->canHarvest()) {
-        std::cout << "❌ Plant is not ready to harvest!" << std::endl;
-        return false;
-    }
-    
-    int value = 0;
-    if (plant->harvest(value)) {
-        currency += value;
-        totalMoneyEarned += value;
-        totalPlantsGrown++;
-        
-        // Add to inventory
-        std::string plantName = plant->getPlantTypeInfo().name;
-        inventory->addItem(plantName, "plant", 1, value);
-        
-        std::cout << "🌾 Harvested " << plantName << " for $" << value << std::endl;
-        
-        // Remove plant
-        delete plant;
-        plants[index] = nullptr;
-        
-        return true;
-    }
-    
-    return false;
-}
-
-bool GameManager::hireWorker(const std::string& name) {
-    if (currency < Config::WORKER_HIRE_COST) {
-        std::cout << "❌ Not enough money to hire worker!" << std::endl;
-        return false;
-    }
-    
-    currency -= Config::WORKER_HIRE_COST;
-    
-    int workerId = static_cast<int>(workers.size()) + 1;
-    Worker* newWorker = new Worker(workerId, name);
-    workers.push_back(newWorker);
-    workScheduler->registerWorker(newWorker);
-    
-    std::cout << "✅ Hired " << name << " as worker #" << workerId << std::endl;
-    return true;
-}
-
-bool GameManager::buyItem(const std::string& itemName) {
-    // TODO: Implement shop
-    return false;
-}
-
-void GameManager::spawnCustomer() {
-    Customer* customer = CustomerFactory::createRandomCustomer();
-    customerQueue.push(customer);
-}
-
-void GameManager::processCustomers(float deltaTime) {
-    // Update all customers in queue
-    std::queue<Customer*> updatedQueue;
-    
-    while (!customerQueue.empty()) {
-        Customer* customer = customerQueue.front();
-        customerQueue.pop();
-        
-        customer->update(deltaTime);
-        
-        if (customer->hasTimedOut() || customer->isServed()) {
-            if (customer->hasTimedOut()) {
-                customerRating -= Config::RATING_TIMEOUT_PENALTY;
-            }
-            delete customer;
-        } else {
-            updatedQueue.push(customer);
-        }
-    }
-    
-    customerQueue = updatedQueue;
-}
-
-void GameManager::updatePlants(float deltaTime) {
-    for (Plant* plant : plants) {
-        if (plant != nullptr) {
-            plant->update(deltaTime);
-        }
-    }
-}
-
-void GameManager::updateWorkers(float deltaTime) {
-    workScheduler->updateAllWorkers(deltaTime);
-}
-
-void GameManager::checkDayEnd() {
-    std::cout << "\n🌙 End of Day " << timeManager->getCurrentDay() << std::endl;
-    workScheduler->payAllWorkers(currency);
-    
-    // Auto-create snapshot at end of day
-    createSnapshot();
-}
\ No newline at end of file
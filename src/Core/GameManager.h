@@ -2,22 +2,15 @@
 #define GAMEMANAGER_H
 
 #include <SFML/Graphics.hpp>
-#include <vector>
-#include <queue>
-#include "TimeManager.h"
-#include "SaveManager.h"
+#include <string>
 #include "Config.h"
-#include "Patterns/Memento/Caretaker.h"
-#include "Patterns/Memento/GameMemento.h"
-#include "Greenhouse/Plant.h"
+#include "Simulation.h"
+#include "Clock.h"
+#include "Greenhouse/PlantTypes.h"
 
 // Forward declarations
 class Plant;
 class Worker;
-class Customer;
-class WorkScheduler;
-class StorageContainer;
-class Inventory;
 
 enum class GameState {
     MAIN_MENU,
@@ -28,7 +21,8 @@ enum class GameState {
     SAVE_MENU
 };
 
-// Main game controller (Originator in Memento Pattern)
+// Main game controller: SFML window, input and rendering
+// All game state and update logic lives in Simulation
 class GameManager {
 private:
     // SFML
@@ -38,64 +32,45 @@ private:
     // Game state
     GameState currentState;
     
-    // Core managers
-    TimeManager* timeManager;
-    SaveManager* saveManager;
-    WorkScheduler* workScheduler;
-    Caretaker* caretaker;  // Memento Pattern: Caretaker
-    
-    // Game data
-    double currency;
-    double customerRating;
-    int greenhouseWidth;
-    int greenhouseHeight;
-    std::vector<Plant*> plants;
-    std::vector<Worker*> workers;
-    std::queue<Customer*> customerQueue;
-    
-    // Storage & Inventory
-    StorageContainer* mainStorage;
-    Inventory* inventory;
+    // Simulation (core game state and update logic)
+    Simulation* simulation;
+    
+    // Single authoritative clock for the fixed-timestep loop
+    SteadyClock defaultClock;
+    const Clock* clock;
     
     // UI state
-    Plant* selectedPlant;
     Worker* selectedWorker;
     int selectedTileX;
     int selectedTileY;
+    bool showProfiler;  // F3: frame phase overlay
     
-    // Timers
-    float customerSpawnTimer;
-    float dayTimer;
+    // UI text, rebuilt only in frames with budget to spare
+    std::string infoText;
+    std::string profilerReport;
     
-    // Statistics
-    int totalPlantsGrown;
-    int totalCustomersServed;
-    double totalMoneyEarned;
+    // Session recording (starts with the next new game)
+    SessionRecorder recorder;
+    std::string recordPath;
     
     // Helper methods
     void initializeWindow();
-    void initializeGame();
     void handleInput();
-    void update(float deltaTime);
     void render();
     
-    // Game logic
-    void spawnCustomer();
-    void processCustomers(float deltaTime);
-    void updatePlants(float deltaTime);
-    void updateWorkers(float deltaTime);
-    void checkDayEnd();
-    
     // UI methods
     void drawGreenhouse();
     void drawUI();
     void drawPlantInfo(Plant* plant);
+    void syncSelectedPlant();
     void drawWorkerInfo(Worker* worker);
+    void drawProfilerOverlay();
+    bool canRebuildText(const std::string& cached) const;
     void drawMainMenu();
     void drawPauseMenu();
     
 public:
-    GameManager();
+    explicit GameManager(const Clock* gameClock = nullptr);  // nullptr = real time
     ~GameManager();
     
     void run();
@@ -108,23 +83,31 @@ public:
     void resumeGame();
     void quitGame();
     
-    // Memento Pattern: Originator methods
-    void createSnapshot();
-    void restoreSnapshot(int index);
-    void undoToLastSnapshot();
-    void listSnapshots() const;
+    // Record the session from the next new game (replay with templanter_headless --replay)
+    void recordSessionTo(const std::string& path) { recordPath = path; }
+    
+    // Time warp
+    void setWarpFactor(float factor) { simulation->setWarpFactor(factor); }
+    float getWarpFactor() const { return simulation->getWarpFactor(); }
+    
+    // Memento Pattern: delegated to Simulation (the Originator)
+    void createSnapshot() { simulation->createSnapshot(); }
+    void restoreSnapshot(int index) { simulation->restoreSnapshot(index); }
+    void undoToLastSnapshot() { simulation->undoToLastSnapshot(); }
+    void listSnapshots() const { simulation->listSnapshots(); }
     
     // Player actions
-    bool plantSeed(PlantType type, int x, int y);
-    bool waterPlant(int x, int y);
-    bool harvestPlant(int x, int y);
-    bool hireWorker(const std::string& name);
-    bool buyItem(const std::string& itemName);
+    bool plantSeed(PlantType type, int x, int y) { return simulation->plantSeed(type, x, y); }
+    bool waterPlant(int x, int y) { return simulation->waterPlant(x, y); }
+    bool harvestPlant(int x, int y) { return simulation->harvestPlant(x, y); }
+    bool hireWorker(const std::string& name) { return simulation->hireWorker(name); }
+    bool buyItem(const std::string& itemName) { return simulation->buyItem(itemName); }
     
     // Getters
-    double getCurrency() const { return currency; }
-    double getRating() const { return customerRating; }
+    double getCurrency() const { return simulation->getCurrency(); }
+    double getRating() const { return simulation->getRating(); }
+    Simulation* getSimulation() const { return simulation; }
     bool isRunning() const { return window && window->isOpen(); }
 };
 
-#endif // GAMEMANAGER_H
\ No newline at end of file
+#endif // GAMEMANAGER_H
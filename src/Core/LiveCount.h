@@ -0,0 +1,31 @@
+#ifndef LIVECOUNT_H
+#define LIVECOUNT_H
+
+#include <atomic>
+
+// ============================================
+// LIVE OBJECT COUNT
+// ============================================
+// Counts the instances of T alive right now. A class opts in by deriving
+// from LiveCount<itself>; every constructor (including copies) adds one
+// and the destructor takes it away. Soak runs sample getLiveCount() to
+// spot objects that are created but never freed.
+template <typename T>
+class LiveCount {
+private:
+    static std::atomic<long long>& counter() {
+        static std::atomic<long long> live(0);
+        return live;
+    }
+
+protected:
+    LiveCount() { counter().fetch_add(1, std::memory_order_relaxed); }
+    LiveCount(const LiveCount&) { counter().fetch_add(1, std::memory_order_relaxed); }
+    LiveCount& operator=(const LiveCount&) = default;
+    ~LiveCount() { counter().fetch_sub(1, std::memory_order_relaxed); }
+
+public:
+    static long long getLiveCount() { return counter().load(std::memory_order_relaxed); }
+};
+
+#endif // LIVECOUNT_H
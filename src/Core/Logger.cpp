@@ -0,0 +1,283 @@
+#include "Logger.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+// ============================================
+// PER-THREAD LINE BUFFER
+// ============================================
+namespace {
+
+// Fixed-size put area; characters past the end are dropped, so building
+// a line never allocates
+class LineBuffer : public std::streambuf {
+private:
+    char data[Logger::MAX_MESSAGE_LENGTH];
+
+protected:
+    int_type overflow(int_type) override { return traits_type::eof(); }
+
+public:
+    LineBuffer() { reset(); }
+
+    void reset() { setp(data, data + sizeof(data)); }
+    const char* text() const { return pbase(); }
+    size_t length() const { return static_cast<size_t>(pptr() - pbase()); }
+};
+
+struct ThreadLine {
+    LineBuffer buffer;
+    std::ostream stream;
+
+    ThreadLine() : stream(&buffer) {}
+};
+
+thread_local ThreadLine threadLine;
+
+const uint64_t QUEUE_MASK = Logger::QUEUE_CAPACITY - 1;
+static_assert((Logger::QUEUE_CAPACITY & (Logger::QUEUE_CAPACITY - 1)) == 0, "QUEUE_CAPACITY must be a power of two");
+
+// Idle drain thread wakes this often to look for new lines
+const std::chrono::milliseconds DRAIN_INTERVAL(5);
+
+} // namespace
+
+// ============================================
+// Singleton
+// ============================================
+std::atomic<Logger*> Logger::instance(nullptr);
+std::mutex Logger::instanceMutex;
+std::atomic<int> Logger::minLevel(static_cast<int>(LogLevel::DEBUG));
+std::atomic<uint32_t> Logger::categoryMask(~0u);
+
+Logger* Logger::getInstance() {
+    Logger* current = instance.load(std::memory_order_acquire);
+    if (current == nullptr) {
+        // First log may come from several plant-update threads at once
+        std::lock_guard<std::mutex> lock(instanceMutex);
+        current = instance.load();
+        if (current == nullptr) {
+            static bool exitHookRegistered = false;
+            current = new Logger();
+            instance.store(current, std::memory_order_release);
+            if (!exitHookRegistered) {
+                std::atexit(Logger::destroyInstance);  // Drain before the process exits
+                exitHookRegistered = true;
+            }
+        }
+    }
+    return current;
+}
+
+void Logger::destroyInstance() {
+    std::lock_guard<std::mutex> lock(instanceMutex);
+    Logger* current = instance.exchange(nullptr);
+    delete current;
+}
+
+Logger::Logger()
+    : records(new Record[QUEUE_CAPACITY]), writeIndex(0), readIndex(0), drainedIndex(0),
+      droppedCount(0), output(&std::cout), errorOutput(&std::cerr), running(true) {
+    for (int i = 0; i < QUEUE_CAPACITY; i++) {
+        records[i].sequence.store(static_cast<uint64_t>(i), std::memory_order_relaxed);
+    }
+    drainThread = std::thread(&Logger::drainLoop, this);
+}
+
+Logger::~Logger() {
+    running.store(false);
+    wakeSignal.notify_one();
+    if (drainThread.joinable()) {
+        drainThread.join();
+    }
+    delete[] records;
+}
+
+// ============================================
+// Producers
+// ============================================
+std::ostream& Logger::beginMessage() {
+    ThreadLine& line = threadLine;
+    line.buffer.reset();
+
+    // Each line starts from default formatting, like a fresh std::cout
+    line.stream.clear();
+    line.stream.flags(std::ios_base::dec | std::ios_base::skipws);
+    line.stream.precision(6);
+    line.stream.width(0);
+    line.stream.fill(' ');
+    return line.stream;
+}
+
+void Logger::submitMessage(LogLevel level, LogCategory category) {
+    const ThreadLine& line = threadLine;
+    push(level, category, line.buffer.text(), line.buffer.length());
+}
+
+void Logger::write(LogLevel level, LogCategory category, const std::string& message) {
+    push(level, category, message.data(), message.size());
+}
+
+void Logger::push(LogLevel level, LogCategory category, const char* text, size_t length) {
+    // Bounded MPSC ring: a slot is free for ticket N when its sequence is N,
+    // and holds a line for the drain thread when its sequence is N + 1
+    uint64_t ticket = writeIndex.load(std::memory_order_relaxed);
+    Record* record;
+    for (;;) {
+        record = &records[ticket & QUEUE_MASK];
+        uint64_t sequence = record->sequence.load(std::memory_order_acquire);
+        int64_t lag = static_cast<int64_t>(sequence - ticket);
+
+        if (lag == 0) {
+            if (writeIndex.compare_exchange_weak(ticket, ticket + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (lag < 0) {
+            // Ring full: never stall the simulation for a log line
+            droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            ticket = writeIndex.load(std::memory_order_relaxed);
+        }
+    }
+
+    if (length > sizeof(record->text)) {
+        length = sizeof(record->text);
+    }
+    std::memcpy(record->text, text, length);
+    record->length = static_cast<uint16_t>(length);
+    record->level = level;
+    record->category = category;
+    record->sequence.store(ticket + 1, std::memory_order_release);
+}
+
+// ============================================
+// Drain thread
+// ============================================
+bool Logger::drainOne() {
+    Record& record = records[readIndex & QUEUE_MASK];
+    if (record.sequence.load(std::memory_order_acquire) != readIndex + 1) {
+        return false;
+    }
+
+    std::ostream* target = (record.level >= LogLevel::ERROR) ? errorOutput.load() : output.load();
+    if (target != nullptr) {
+        target->write(record.text, record.length);
+        target->put('\n');
+    }
+
+    record.sequence.store(readIndex + QUEUE_CAPACITY, std::memory_order_release);
+    readIndex++;
+    return true;
+}
+
+void Logger::drainLoop() {
+    uint64_t reportedDrops = 0;
+
+    for (;;) {
+        bool wrote = false;
+        while (drainOne()) {
+            wrote = true;
+        }
+
+        uint64_t dropped = droppedCount.load(std::memory_order_relaxed);
+        if (dropped != reportedDrops && output.load() != nullptr) {
+            *output.load() << "⚠️  Logger dropped " << (dropped - reportedDrops) << " line(s)\n";
+            reportedDrops = dropped;
+            wrote = true;
+        }
+
+        if (wrote) {
+            // One flush per batch instead of one per line
+            if (output.load() != nullptr) {
+                output.load()->flush();
+            }
+            if (errorOutput.load() != nullptr) {
+                errorOutput.load()->flush();
+            }
+
+            std::lock_guard<std::mutex> lock(signalMutex);
+            drainedIndex.store(readIndex);
+            drainedSignal.notify_all();
+        }
+
+        if (!running.load()) {
+            // Stop only once the ring is empty
+            if (records[readIndex & QUEUE_MASK].sequence.load(std::memory_order_acquire) != readIndex + 1) {
+                break;
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(signalMutex);
+        wakeSignal.wait_for(lock, DRAIN_INTERVAL);
+    }
+}
+
+void Logger::flush() {
+    uint64_t target = writeIndex.load();
+    wakeSignal.notify_one();
+
+    std::unique_lock<std::mutex> lock(signalMutex);
+    drainedSignal.wait(lock, [this, target] { return drainedIndex.load() >= target; });
+}
+
+// ============================================
+// Configuration
+// ============================================
+void Logger::setCategoryEnabled(LogCategory category, bool enabled) {
+    uint32_t bit = 1u << static_cast<int>(category);
+    if (enabled) {
+        categoryMask.fetch_or(bit);
+    } else {
+        categoryMask.fetch_and(~bit);
+    }
+}
+
+bool Logger::isCategoryEnabled(LogCategory category) {
+    return (categoryMask.load() & (1u << static_cast<int>(category))) != 0;
+}
+
+void Logger::setOutput(std::ostream* out, std::ostream* errorOut) {
+    // Finish writing to the old streams first
+    flush();
+    output.store(out);
+    errorOutput.store(errorOut);
+}
+
+const char* Logger::getLevelName(LogLevel level) {
+    switch (level) {
+        case LogLevel::DEBUG: return "debug";
+        case LogLevel::INFO:  return "info";
+        case LogLevel::WARN:  return "warn";
+        case LogLevel::ERROR: return "error";
+        case LogLevel::OFF:   return "off";
+    }
+    return "unknown";
+}
+
+bool Logger::parseLevel(const std::string& name, LogLevel& level) {
+    for (int i = 0; i <= static_cast<int>(LogLevel::OFF); i++) {
+        if (name == getLevelName(static_cast<LogLevel>(i))) {
+            level = static_cast<LogLevel>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+const char* Logger::getCategoryName(LogCategory category) {
+    switch (category) {
+        case LogCategory::GENERAL:  return "general";
+        case LogCategory::SIM:      return "sim";
+        case LogCategory::PLANT:    return "plant";
+        case LogCategory::STAFF:    return "staff";
+        case LogCategory::CUSTOMER: return "customer";
+        case LogCategory::SAVE:     return "save";
+        case LogCategory::STORAGE:  return "storage";
+        case LogCategory::UI:       return "ui";
+        case LogCategory::COUNT:    break;
+    }
+    return "unknown";
+}
@@ -0,0 +1,144 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+
+enum class LogLevel : uint8_t {
+    DEBUG,   // Per-plant / per-task chatter (stripped from optimised builds)
+    INFO,
+    WARN,
+    ERROR,
+    OFF
+};
+
+enum class LogCategory : uint8_t {
+    GENERAL,
+    SIM,
+    PLANT,
+    STAFF,
+    CUSTOMER,
+    SAVE,
+    STORAGE,
+    UI,
+    COUNT
+};
+
+// Compile-time floor: log calls below this level compile to nothing.
+// CMake sets it to 1 (INFO) for non-Debug builds.
+#ifndef TEMPLANTER_LOG_MIN_LEVEL
+#define TEMPLANTER_LOG_MIN_LEVEL 0
+#endif
+
+// ============================================
+// LOGGER (Singleton)
+// ============================================
+// Callers format into a per-thread line buffer and push the line onto a
+// bounded lock-free ring; a background thread drains the ring to the
+// output stream. Producers never block or flush: when the ring is full
+// the line is dropped and counted.
+class Logger {
+public:
+    static const int QUEUE_CAPACITY = 4096;      // Lines; power of two
+    static const int MAX_MESSAGE_LENGTH = 240;   // Longer lines are truncated
+
+private:
+    struct Record {
+        std::atomic<uint64_t> sequence;  // Ring slot turn (see push/drainOne)
+        LogLevel level;
+        LogCategory category;
+        uint16_t length;
+        char text[MAX_MESSAGE_LENGTH];
+    };
+
+    static std::atomic<Logger*> instance;
+    static std::mutex instanceMutex;
+
+    // Runtime filters (checked before formatting)
+    static std::atomic<int> minLevel;
+    static std::atomic<uint32_t> categoryMask;
+
+    Record* records;
+    std::atomic<uint64_t> writeIndex;    // Next slot producers claim
+    uint64_t readIndex;                  // Drain thread only
+    std::atomic<uint64_t> drainedIndex;  // Lines written out so far
+    std::atomic<uint64_t> droppedCount;
+
+    std::atomic<std::ostream*> output;       // nullptr discards
+    std::atomic<std::ostream*> errorOutput;  // ERROR lines
+
+    std::thread drainThread;
+    std::atomic<bool> running;
+    std::mutex signalMutex;                 // Only the drain thread and flush() wait on these
+    std::condition_variable wakeSignal;
+    std::condition_variable drainedSignal;
+
+    Logger();
+    ~Logger();
+
+    void push(LogLevel level, LogCategory category, const char* text, size_t length);
+    void drainLoop();
+    bool drainOne();
+
+public:
+    static Logger* getInstance();
+    static void destroyInstance();  // Drains and joins; registered with atexit
+
+    // Delete copy constructor and assignment
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    static bool shouldLog(LogLevel level, LogCategory category) {
+        return static_cast<int>(level) >= minLevel.load(std::memory_order_relaxed) &&
+               (categoryMask.load(std::memory_order_relaxed) & (1u << static_cast<int>(category))) != 0;
+    }
+
+    // Per-thread stream for the line being built (reset on each call)
+    static std::ostream& beginMessage();
+
+    // Queue this thread's current line (non-blocking)
+    void submitMessage(LogLevel level, LogCategory category);
+    void write(LogLevel level, LogCategory category, const std::string& message);
+
+    // Block until every line queued before the call has been written
+    void flush();
+
+    // Configuration
+    static void setLevel(LogLevel level) { minLevel.store(static_cast<int>(level)); }
+    static LogLevel getLevel() { return static_cast<LogLevel>(minLevel.load()); }
+    static void setCategoryEnabled(LogCategory category, bool enabled);
+    static bool isCategoryEnabled(LogCategory category);
+    void setOutput(std::ostream* out, std::ostream* errorOut);
+
+    uint64_t getDroppedCount() const { return droppedCount.load(); }
+
+    static const char* getLevelName(LogLevel level);
+    static bool parseLevel(const std::string& name, LogLevel& level);
+    static const char* getCategoryName(LogCategory category);
+};
+
+// ============================================
+// LOG MACROS
+// ============================================
+// LOG_INFO(PLANT, "Watered " << name);
+// The message is only formatted when the level and category are enabled.
+#define TEMPLANTER_LOG(level, category, message)                                        \
+    do {                                                                                \
+        if (static_cast<int>(level) >= TEMPLANTER_LOG_MIN_LEVEL &&                      \
+            Logger::shouldLog(level, category)) {                                       \
+            Logger::beginMessage() << message;                                          \
+            Logger::getInstance()->submitMessage(level, category);                      \
+        }                                                                               \
+    } while (0)
+
+#define LOG_DEBUG(category, message) TEMPLANTER_LOG(LogLevel::DEBUG, LogCategory::category, message)
+#define LOG_INFO(category, message)  TEMPLANTER_LOG(LogLevel::INFO, LogCategory::category, message)
+#define LOG_WARN(category, message)  TEMPLANTER_LOG(LogLevel::WARN, LogCategory::category, message)
+#define LOG_ERROR(category, message) TEMPLANTER_LOG(LogLevel::ERROR, LogCategory::category, message)
+
+#endif // LOGGER_H
@@ -0,0 +1,239 @@
+#include "Metrics.h"
+#include "Config.h"
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#ifdef __unix__
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+// ============================================
+// Singleton
+// ============================================
+MetricsRegistry* MetricsRegistry::instance = nullptr;
+
+MetricsRegistry* MetricsRegistry::getInstance() {
+    if (instance == nullptr) {
+        instance = new MetricsRegistry();
+    }
+    return instance;
+}
+
+void MetricsRegistry::destroyInstance() {
+    if (instance != nullptr) {
+        delete instance;
+        instance = nullptr;
+    }
+}
+
+MetricsRegistry::MetricsRegistry()
+    : intervalSeconds(Config::METRICS_INTERVAL_SECONDS), lastPublish(MetricsClock::now()),
+      socketFd(-1), socketRunning(false) {
+}
+
+MetricsRegistry::~MetricsRegistry() {
+    close();
+}
+
+// ============================================
+// Registration
+// ============================================
+int MetricsRegistry::addMetric(MetricType type, const std::string& name, const std::string& help,
+                               const std::string& labels) {
+    Metric metric;
+    metric.name = name;
+    metric.help = help;
+    metric.labels = labels;
+    metric.type = type;
+    metric.value = 0.0;
+    metrics.push_back(metric);
+    return static_cast<int>(metrics.size()) - 1;
+}
+
+int MetricsRegistry::addGauge(const std::string& name, const std::string& help, const std::string& labels) {
+    return addMetric(MetricType::GAUGE, name, help, labels);
+}
+
+int MetricsRegistry::addCounter(const std::string& name, const std::string& help, const std::string& labels) {
+    return addMetric(MetricType::COUNTER, name, help, labels);
+}
+
+// ============================================
+// Outputs
+// ============================================
+bool MetricsRegistry::openFile(const std::string& path) {
+    filePath = path;
+    if (!writeFile("")) {  // Fail early on an unwritable path
+        filePath.clear();
+        return false;
+    }
+    return true;
+}
+
+bool MetricsRegistry::writeFile(const std::string& text) const {
+    // Scrapers never see a half-written file
+    std::string temporary = filePath + ".tmp";
+    {
+        std::ofstream file(temporary.c_str());
+        if (!file) {
+            return false;
+        }
+        file << text;
+        if (!file) {
+            return false;
+        }
+    }
+    return std::rename(temporary.c_str(), filePath.c_str()) == 0;
+}
+
+bool MetricsRegistry::openSocket(const std::string& path) {
+#ifdef __unix__
+    sockaddr_un address = {};
+    if (socketFd >= 0 || path.size() >= sizeof(address.sun_path)) {
+        return false;
+    }
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return false;
+    }
+    address.sun_family = AF_UNIX;
+    path.copy(address.sun_path, path.size());
+    unlink(path.c_str());  // Stale socket from an earlier run
+    if (bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(fd, 4) != 0) {
+        ::close(fd);
+        return false;
+    }
+
+    socketPath = path;
+    socketFd = fd;
+    socketRunning = true;
+    socketThread = std::thread(&MetricsRegistry::serveSocket, this);
+    return true;
+#else
+    (void)path;
+    return false;
+#endif
+}
+
+void MetricsRegistry::serveSocket() {
+#ifdef __unix__
+    while (socketRunning) {
+        // Wake periodically so close() can stop the thread
+        pollfd listener = {socketFd, POLLIN, 0};
+        if (poll(&listener, 1, 200) <= 0) {
+            continue;
+        }
+        int client = accept(socketFd, nullptr, nullptr);
+        if (client < 0) {
+            continue;
+        }
+
+        std::string text;
+        {
+            std::lock_guard<std::mutex> lock(textMutex);
+            text = latestText;
+        }
+        size_t sent = 0;
+        while (sent < text.size()) {
+            ssize_t written = send(client, text.data() + sent, text.size() - sent, MSG_NOSIGNAL);
+            if (written <= 0) {
+                break;
+            }
+            sent += static_cast<size_t>(written);
+        }
+        ::close(client);
+    }
+#endif
+}
+
+void MetricsRegistry::close() {
+#ifdef __unix__
+    if (socketFd >= 0) {
+        socketRunning = false;
+        if (socketThread.joinable()) {
+            socketThread.join();
+        }
+        ::close(socketFd);
+        unlink(socketPath.c_str());
+        socketFd = -1;
+        socketPath.clear();
+    }
+#endif
+    filePath.clear();
+}
+
+// ============================================
+// Process
+// ============================================
+double MetricsRegistry::getResidentBytes() {
+#ifdef __unix__
+    std::ifstream statm("/proc/self/statm");
+    long pages = 0;
+    long residentPages = 0;
+    if (statm >> pages >> residentPages) {
+        return static_cast<double>(residentPages) * static_cast<double>(sysconf(_SC_PAGESIZE));
+    }
+#endif
+    return -1.0;
+}
+
+// ============================================
+// Publishing
+// ============================================
+bool MetricsRegistry::isDue() const {
+    return isOpen() && getSecondsSinceLastPublish() >= intervalSeconds;
+}
+
+double MetricsRegistry::getSecondsSinceLastPublish() const {
+    std::chrono::duration<double> elapsed = MetricsClock::now() - lastPublish;
+    return elapsed.count();
+}
+
+void MetricsRegistry::publish() {
+    std::ostringstream text;
+    writePrometheus(text);
+
+    if (!filePath.empty()) {
+        writeFile(text.str());
+    }
+    if (socketFd >= 0) {
+        std::lock_guard<std::mutex> lock(textMutex);
+        latestText = text.str();
+    }
+
+    lastPublish = MetricsClock::now();
+}
+
+void MetricsRegistry::writePrometheus(std::ostream& out) const {
+    std::streamsize precision = out.precision();
+    out << std::setprecision(15);  // Counters stay exact well past 10^6
+    const std::string* previousName = nullptr;
+    for (const Metric& metric : metrics) {
+        // HELP/TYPE once per metric family
+        if (previousName == nullptr || *previousName != metric.name) {
+            out << "# HELP " << metric.name << " " << metric.help << "\n";
+            out << "# TYPE " << metric.name << " "
+                << (metric.type == MetricType::COUNTER ? "counter" : "gauge") << "\n";
+            previousName = &metric.name;
+        }
+        out << metric.name;
+        if (!metric.labels.empty()) {
+            out << "{" << metric.labels << "}";
+        }
+        out << " " << metric.value << "\n";
+    }
+
+    double residentBytes = getResidentBytes();
+    if (residentBytes >= 0.0) {
+        out << "# HELP process_resident_memory_bytes Resident memory size in bytes.\n";
+        out << "# TYPE process_resident_memory_bytes gauge\n";
+        out << "process_resident_memory_bytes " << static_cast<long long>(residentBytes) << "\n";
+    }
+    out.precision(precision);
+}
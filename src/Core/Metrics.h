@@ -0,0 +1,100 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+enum class MetricType : uint8_t {
+    GAUGE,
+    COUNTER
+};
+
+// ============================================
+// METRICS REGISTRY (Singleton)
+// ============================================
+// Named gauges and counters held as plain doubles: register once, then
+// set()/add() by id is an indexed store. publish() renders the
+// Prometheus text format and hands it to the enabled outputs:
+//   - a file, replaced atomically (write + rename) for a scraper to read
+//   - a UNIX socket, where each connection receives the latest text
+// Values are written from the main thread; the socket thread only ever
+// sees the rendered text.
+class MetricsRegistry {
+public:
+    typedef std::chrono::steady_clock MetricsClock;
+
+private:
+    static MetricsRegistry* instance;
+
+    struct Metric {
+        std::string name;
+        std::string help;
+        std::string labels;  // Without braces, e.g. state="idle"
+        MetricType type;
+        double value;
+    };
+
+    std::vector<Metric> metrics;
+    double intervalSeconds;
+    MetricsClock::time_point lastPublish;
+
+    std::string filePath;
+
+    // UNIX socket output
+    std::string socketPath;
+    int socketFd;
+    std::thread socketThread;
+    std::atomic<bool> socketRunning;
+    std::mutex textMutex;
+    std::string latestText;
+
+    MetricsRegistry();
+
+    int addMetric(MetricType type, const std::string& name, const std::string& help,
+                  const std::string& labels);
+    void serveSocket();
+    bool writeFile(const std::string& text) const;
+
+public:
+    ~MetricsRegistry();
+
+    static MetricsRegistry* getInstance();
+    static void destroyInstance();
+
+    // Delete copy constructor and assignment
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+    // Metrics sharing a name must be registered one after another
+    int addGauge(const std::string& name, const std::string& help, const std::string& labels = "");
+    int addCounter(const std::string& name, const std::string& help, const std::string& labels = "");
+
+    void set(int id, double value) { metrics[id].value = value; }
+    void add(int id, double delta) { metrics[id].value += delta; }
+    double get(int id) const { return metrics[id].value; }
+
+    // Outputs (both may be active)
+    bool openFile(const std::string& path);
+    bool openSocket(const std::string& path);
+    void close();
+    bool isOpen() const { return !filePath.empty() || socketFd >= 0; }
+
+    // Publish cadence
+    void setInterval(double seconds) { intervalSeconds = seconds; }
+    bool isDue() const;
+    double getSecondsSinceLastPublish() const;  // Since construction until the first publish
+    void publish();
+
+    void writePrometheus(std::ostream& out) const;
+
+    // Resident set size from /proc, or -1 where unavailable
+    static double getResidentBytes();
+};
+
+#endif // METRICS_H
@@ -0,0 +1,93 @@
+#include "Random.h"
+#include "Config.h"
+
+namespace {
+
+uint64_t splitMix64(uint64_t& x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    uint64_t z = x;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+inline uint64_t rotateLeft(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+// Seed for stream n of a session: distinct streams never share state
+uint64_t streamSeed(uint64_t sessionSeed, uint64_t key) {
+    uint64_t x = sessionSeed ^ (key * 0xD1B54A32D192ED03ULL);
+    return splitMix64(x);
+}
+
+} // namespace
+
+// ============================================
+// Stream
+// ============================================
+void RandomStream::reseed(uint64_t seed) {
+    uint64_t x = seed;
+    for (uint64_t& word : state) {
+        word = splitMix64(x);
+    }
+}
+
+uint64_t RandomStream::next() {
+    uint64_t result = rotateLeft(state[1] * 5, 7) * 9;
+    uint64_t t = state[1] << 17;
+
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = rotateLeft(state[3], 45);
+
+    return result;
+}
+
+int RandomStream::nextInt(int low, int high) {
+    if (high <= low) {
+        return low;
+    }
+    // Multiply-shift on 32 random bits (range <= 2^32, so no overflow);
+    // bias is range / 2^32, negligible for game-sized ranges
+    uint64_t range = static_cast<uint64_t>(static_cast<int64_t>(high) - low) + 1;
+    uint64_t scaled = ((next() >> 32) * range) >> 32;
+    return static_cast<int>(low + static_cast<int64_t>(scaled));
+}
+
+double RandomStream::nextDouble() {
+    return static_cast<double>(next() >> 11) * (1.0 / 9007199254740992.0);  // 53 bits
+}
+
+// ============================================
+// Singleton
+// ============================================
+RandomService* RandomService::instance = nullptr;
+
+RandomService* RandomService::getInstance() {
+    if (instance == nullptr) {
+        instance = new RandomService();
+    }
+    return instance;
+}
+
+void RandomService::destroyInstance() {
+    if (instance != nullptr) {
+        delete instance;
+        instance = nullptr;
+    }
+}
+
+RandomService::RandomService() : seedValue(0) {
+    seed(Config::SIM_DEFAULT_SEED);
+}
+
+void RandomService::seed(uint64_t sessionSeed) {
+    seedValue = sessionSeed;
+    for (int i = 0; i < static_cast<int>(RandomStreamId::COUNT); i++) {
+        streams[i].reseed(streamSeed(sessionSeed, static_cast<uint64_t>(i)));
+    }
+}
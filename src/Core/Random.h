@@ -0,0 +1,67 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <cstdint>
+
+// ============================================
+// RANDOM STREAM (xoshiro256**)
+// ============================================
+// Small, fast generator with 256 bits of state; seeding expands a
+// 64-bit seed with SplitMix64. Range helpers are defined here rather than
+// with <random> distributions so sequences are identical on every
+// standard library (recorded sessions replay across platforms).
+class RandomStream {
+private:
+    uint64_t state[4];
+
+public:
+    explicit RandomStream(uint64_t seed = 0) { reseed(seed); }
+
+    void reseed(uint64_t seed);
+    uint64_t next();
+
+    int nextInt(int low, int high);  // Uniform in [low, high]
+    double nextDouble();             // Uniform in [0, 1)
+    bool chance(double probability) { return nextDouble() < probability; }
+};
+
+// Independent streams per subsystem, so adding a roll in one subsystem
+// does not shift the sequence seen by another
+enum class RandomStreamId : uint8_t {
+    CUSTOMERS,   // Arrivals, names, requests, theft amounts
+    WORKERS,     // Starting skills, tips, security checks
+    PLANTS,      // Demand-weighted plant picks
+    COUNT
+};
+
+// ============================================
+// RANDOM SERVICE (Singleton)
+// ============================================
+// Owns one stream per subsystem, all derived from the session seed that
+// Simulation::initialize() sets. Streams are for the main thread only.
+class RandomService {
+private:
+    static RandomService* instance;
+
+    RandomStream streams[static_cast<int>(RandomStreamId::COUNT)];
+    uint64_t seedValue;
+
+    RandomService();
+
+public:
+    static RandomService* getInstance();
+    static void destroyInstance();
+
+    // Delete copy constructor and assignment
+    RandomService(const RandomService&) = delete;
+    RandomService& operator=(const RandomService&) = delete;
+
+    void seed(uint64_t seed);
+    uint64_t getSeed() const { return seedValue; }
+
+    // Shorthand for getInstance()->getStream(id)
+    static RandomStream& stream(RandomStreamId id) { return getInstance()->getStream(id); }
+    RandomStream& getStream(RandomStreamId id) { return streams[static_cast<int>(id)]; }
+};
+
+#endif // RANDOM_H
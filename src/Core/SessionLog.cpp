@@ -0,0 +1,207 @@
+#include "SessionLog.h"
+#include <algorithm>
+
+namespace {
+
+const char SESSION_MAGIC[4] = {'T', 'P', 'L', 'S'};
+const uint32_t SESSION_VERSION = 1;
+
+} // namespace
+
+// ============================================
+// Recorder
+// ============================================
+SessionRecorder::SessionRecorder()
+    : pendingTickSeconds(0.0f), pendingTicks(0), recordCount(0) {
+}
+
+SessionRecorder::~SessionRecorder() {
+    if (out.is_open()) {
+        flushTicks();  // Unterminated log: replays report no recorded hash
+    }
+}
+
+bool SessionRecorder::open(const std::string& path, int width, int height, uint64_t seed) {
+    out.open(path.c_str(), std::ios::binary | std::ios::trunc);
+    if (!out) {
+        return false;
+    }
+    out.write(SESSION_MAGIC, sizeof(SESSION_MAGIC));
+    write(SESSION_VERSION);
+    write(static_cast<int32_t>(width));
+    write(static_cast<int32_t>(height));
+    write(seed);
+    pendingTicks = 0;
+    recordCount = 0;
+    return static_cast<bool>(out);
+}
+
+void SessionRecorder::close(uint64_t stateHash) {
+    if (!out.is_open()) {
+        return;
+    }
+    writeOp(SessionOp::END);
+    write(stateHash);
+    out.close();
+}
+
+void SessionRecorder::flushTicks() {
+    if (pendingTicks == 0) {
+        return;
+    }
+    out.put(static_cast<char>(SessionOp::TICK));
+    write(pendingTickSeconds);
+    write(pendingTicks);
+    pendingTicks = 0;
+    recordCount++;
+}
+
+void SessionRecorder::writeOp(SessionOp op) {
+    flushTicks();  // Keep actions ordered against the ticks around them
+    out.put(static_cast<char>(op));
+    recordCount++;
+}
+
+void SessionRecorder::writeString(const std::string& value) {
+    uint16_t length = static_cast<uint16_t>(std::min<size_t>(value.size(), UINT16_MAX));
+    write(length);
+    out.write(value.data(), length);
+}
+
+void SessionRecorder::recordTick(float tickSeconds) {
+    if (pendingTicks > 0 && (tickSeconds != pendingTickSeconds || pendingTicks == UINT32_MAX)) {
+        flushTicks();
+    }
+    pendingTickSeconds = tickSeconds;
+    pendingTicks++;
+}
+
+void SessionRecorder::recordAdvance(double gameSeconds, float maxStepSeconds) {
+    writeOp(SessionOp::ADVANCE);
+    write(gameSeconds);
+    write(maxStepSeconds);
+}
+
+void SessionRecorder::recordPlant(PlantType type, int x, int y) {
+    writeOp(SessionOp::PLANT);
+    write(static_cast<uint8_t>(type));
+    write(static_cast<int32_t>(x));
+    write(static_cast<int32_t>(y));
+}
+
+void SessionRecorder::recordTile(SessionOp op, int x, int y) {
+    writeOp(op);
+    write(static_cast<int32_t>(x));
+    write(static_cast<int32_t>(y));
+}
+
+void SessionRecorder::recordText(SessionOp op, const std::string& text) {
+    writeOp(op);
+    writeString(text);
+}
+
+void SessionRecorder::recordWarp(float factor) {
+    writeOp(SessionOp::WARP);
+    write(factor);
+}
+
+void SessionRecorder::recordCurrency(double amount) {
+    writeOp(SessionOp::CURRENCY);
+    write(amount);
+}
+
+void SessionRecorder::recordSnapshot(SessionOp op, int index) {
+    writeOp(op);
+    if (op == SessionOp::RESTORE) {
+        write(static_cast<int32_t>(index));
+    }
+}
+
+// ============================================
+// Reader
+// ============================================
+SessionReader::SessionReader()
+    : width(0), height(0), seed(0), recordedHash(0), ended(false) {
+}
+
+bool SessionReader::open(const std::string& path) {
+    in.open(path.c_str(), std::ios::binary);
+    char magic[4];
+    uint32_t version = 0;
+    int32_t fileWidth = 0;
+    int32_t fileHeight = 0;
+    if (!in.read(magic, sizeof(magic)) || !std::equal(magic, magic + 4, SESSION_MAGIC) ||
+        !read(version) || version != SESSION_VERSION ||
+        !read(fileWidth) || !read(fileHeight) || !read(seed) || fileWidth <= 0 || fileHeight <= 0) {
+        return false;
+    }
+    width = fileWidth;
+    height = fileHeight;
+    ended = false;
+    return true;
+}
+
+bool SessionReader::readString(std::string& value) {
+    uint16_t length = 0;
+    if (!read(length)) {
+        return false;
+    }
+    value.resize(length);
+    return length == 0 || static_cast<bool>(in.read(&value[0], length));
+}
+
+bool SessionReader::next(SessionEvent& event) {
+    int op = in.get();
+    if (op == std::char_traits<char>::eof() || ended) {
+        return false;
+    }
+
+    event.op = static_cast<SessionOp>(op);
+    int32_t x = 0;
+    int32_t y = 0;
+    uint8_t type = 0;
+    bool ok = true;
+
+    switch (event.op) {
+        case SessionOp::TICK:
+            ok = read(event.seconds) && read(event.count);
+            break;
+        case SessionOp::ADVANCE:
+            ok = read(event.value) && read(event.seconds);
+            break;
+        case SessionOp::PLANT:
+            ok = read(type) && read(x) && read(y) && type < PlantTypeDatabase::getPlantTypeCount();  // Catalog lookups are unchecked
+            event.plantType = static_cast<PlantType>(type);
+            break;
+        case SessionOp::WATER:
+        case SessionOp::HARVEST:
+        case SessionOp::SYNC:
+            ok = read(x) && read(y);
+            break;
+        case SessionOp::HIRE:
+        case SessionOp::BUY:
+            ok = readString(event.text);
+            break;
+        case SessionOp::WARP:
+            ok = read(event.seconds);
+            break;
+        case SessionOp::CURRENCY:
+            ok = read(event.value);
+            break;
+        case SessionOp::SNAPSHOT:
+        case SessionOp::UNDO:
+            break;
+        case SessionOp::RESTORE:
+            ok = read(x);
+            break;
+        case SessionOp::END:
+            ended = read(recordedHash);
+            return false;
+        default:
+            return false;  // Unknown opcode: newer or corrupt log
+    }
+
+    event.x = x;
+    event.y = y;
+    return ok;
+}
@@ -0,0 +1,143 @@
+#ifndef SESSIONLOG_H
+#define SESSIONLOG_H
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include "Greenhouse/PlantTypes.h"
+
+// ============================================
+// SESSION LOG (record / replay)
+// ============================================
+// Binary log of everything that drives a Simulation after initialize():
+// player actions, warp changes, snapshot commands and tick boundaries.
+// Replaying it into a fresh Simulation with the same grid and seed
+// reproduces the run, so the same workload can be timed against new
+// builds and the final state hashes compared.
+//
+// Layout (host byte order): header "TPLS" + version + grid + seed, then
+// records of one opcode byte and its payload. Runs of equal ticks are
+// stored as one TICK record with a count. The END record carries the
+// state hash taken when recording stopped.
+
+enum class SessionOp : uint8_t {
+    TICK = 1,      // float tickSeconds, uint32 count
+    ADVANCE,       // double gameSeconds, float maxStepSeconds
+    PLANT,         // uint8 type, int32 x, int32 y
+    WATER,         // int32 x, int32 y
+    HARVEST,       // int32 x, int32 y
+    HIRE,          // string name
+    BUY,           // string item
+    WARP,          // float factor
+    CURRENCY,      // double amount (setCurrency)
+    SNAPSHOT,      // -
+    RESTORE,       // int32 index
+    UNDO,          // -
+    SYNC,          // int32 x, int32 y (syncPlantAt: catch-up changes rounding)
+    END            // uint64 stateHash
+};
+
+struct SessionEvent {
+    SessionOp op;
+    float seconds;      // TICK: tick length; ADVANCE: max step; WARP: factor
+    uint32_t count;     // TICK: repetitions
+    double value;       // ADVANCE: game seconds; CURRENCY: amount
+    int x;              // Tile (PLANT/WATER/HARVEST/SYNC) or snapshot index
+    int y;
+    PlantType plantType;
+    std::string text;   // HIRE / BUY
+};
+
+// FNV-1a over the bytes of the values added
+class StateHash {
+private:
+    uint64_t hash;
+
+public:
+    StateHash() : hash(1469598103934665603ULL) {}
+
+    void addBytes(const void* data, size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; i++) {
+            hash = (hash ^ bytes[i]) * 1099511628211ULL;
+        }
+    }
+
+    template <typename T>
+    void add(const T& value) { addBytes(&value, sizeof(value)); }
+
+    void add(const std::string& value) { addBytes(value.data(), value.size()); }
+
+    uint64_t get() const { return hash; }
+};
+
+class SessionRecorder {
+private:
+    std::ofstream out;
+    float pendingTickSeconds;
+    uint32_t pendingTicks;     // Ticks not yet written (run-length)
+    uint64_t recordCount;
+
+    void flushTicks();
+    void writeOp(SessionOp op);
+    void writeString(const std::string& value);
+
+    template <typename T>
+    void write(const T& value) { out.write(reinterpret_cast<const char*>(&value), sizeof(value)); }
+
+public:
+    SessionRecorder();
+    ~SessionRecorder();
+
+    SessionRecorder(const SessionRecorder&) = delete;
+    SessionRecorder& operator=(const SessionRecorder&) = delete;
+
+    bool open(const std::string& path, int width, int height, uint64_t seed);
+    bool isOpen() const { return out.is_open(); }
+    void close(uint64_t stateHash);  // Writes END and closes the file
+
+    void recordTick(float tickSeconds);
+    void recordAdvance(double gameSeconds, float maxStepSeconds);
+    void recordPlant(PlantType type, int x, int y);
+    void recordTile(SessionOp op, int x, int y);  // WATER / HARVEST / SYNC
+    void recordText(SessionOp op, const std::string& text);  // HIRE / BUY
+    void recordWarp(float factor);
+    void recordCurrency(double amount);
+    void recordSnapshot(SessionOp op, int index = 0);  // SNAPSHOT / RESTORE / UNDO
+
+    uint64_t getRecordCount() const { return recordCount; }
+};
+
+class SessionReader {
+private:
+    std::ifstream in;
+    int width;
+    int height;
+    uint64_t seed;
+    uint64_t recordedHash;
+    bool ended;
+
+    bool readString(std::string& value);
+
+    template <typename T>
+    bool read(T& value) { return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(value))); }
+
+public:
+    SessionReader();
+
+    SessionReader(const SessionReader&) = delete;
+    SessionReader& operator=(const SessionReader&) = delete;
+
+    bool open(const std::string& path);  // Reads and checks the header
+
+    // Next record; false at END or on a truncated/corrupt log
+    bool next(SessionEvent& event);
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    uint64_t getSeed() const { return seed; }
+    bool hasEnded() const { return ended; }           // END record reached
+    uint64_t getRecordedHash() const { return recordedHash; }
+};
+
+#endif // SESSIONLOG_H
@@ -0,0 +1,898 @@
+#include "Simulation.h"
+#include "FrameProfiler.h"
+#include "FrameBudget.h"
+#include "Metrics.h"
+#include "Random.h"
+#include "Greenhouse/Plant.h"
+#include "Greenhouse/PlantTypes.h"
+#include "Staff/Worker.h"
+#include "Patterns/Decorator/WorkerRole.h"
+#include "Customer/Customer.h"
+#include "Patterns/Mediator/WorkScheduler.h"
+#include "Patterns/Composite/StorageComponent.h"
+#include "Patterns/Iterator/InventoryIterator.h"
+#include "Patterns/Factory/CustomerFactory.h"
+#include "Logger.h"
+#include <algorithm>
+#include <limits>
+
+Simulation::Simulation(int width, int height, int workerThreads)
+    : currency(Config::STARTING_MONEY), customerRating(Config::STARTING_RATING),
+      greenhouseWidth(width), greenhouseHeight(height), plantStore(nullptr), nextPlantId(0),
+      plantClock(0.0), catalogGeneration(PlantTypeDatabase::getGeneration()), plantPool(nullptr),
+      customerSpawnTimer(0.0f), dayTimer(0.0f),
+      totalPlantsGrown(0), totalCustomersServed(0), totalMoneyEarned(0.0),
+      stepCount(0), seed(Config::SIM_DEFAULT_SEED), recorder(nullptr), lastMetricsStepCount(0) {
+    metricIds.registered = false;
+    pendingSnapshot.active = false;
+    pendingSnapshot.next = 0;
+    
+    // Initialize singletons
+    timeManager = TimeManager::getInstance();
+    saveManager = SaveManager::getInstance();
+    frameBudget = FrameBudget::getInstance();
+    
+    // Initialize managers
+    workScheduler = new WorkScheduler();
+    caretaker = new Caretaker(10);  // Max 10 snapshots
+    
+    // Initialize storage
+    mainStorage = new StorageContainer("Main Warehouse", 1000);
+    inventory = new Inventory();
+    
+    // Plant data for every tile; the scheduler hears from all of them
+    plantStore = new PlantStore(width * height);
+    plantStore->attachAll(workScheduler);
+    
+    // Worker threads for plant updates
+    plantPool = new ThreadPool(workerThreads);
+    if (plantPool->getThreadCount() <= 1) {
+        delete plantPool;
+        plantPool = nullptr;
+    }
+}
+
+Simulation::~Simulation() {
+    // Clean up workers
+    for (auto* worker : workers) {
+        delete worker;
+    }
+    
+    // Clean up customers
+    while (!customerQueue.empty()) {
+        delete customerQueue.front();
+        customerQueue.pop();
+    }
+    
+    delete plantStore;  // Plants notify the scheduler; release them first
+    delete workScheduler;
+    delete mainStorage;
+    delete inventory;
+    delete caretaker;
+    delete plantPool;
+    
+    // Destroy singletons
+    TimeManager::destroyInstance();
+    SaveManager::destroyInstance();
+    PlantTypeDatabase::destroyInstance();
+}
+
+void Simulation::initialize() {
+    LOG_INFO(SIM, "\n========================================");
+    LOG_INFO(SIM, "     🌱 TEMPLANTER - New Game 🌱");
+    LOG_INFO(SIM, "========================================\n");
+    
+    // Every random roll in the session follows from the seed
+    RandomService::getInstance()->seed(seed);
+    
+    // Initialize greenhouse grid
+    plants.resize(greenhouseWidth * greenhouseHeight, nullptr);
+    resetPlantSchedule();
+    
+    // Give player some starting resources
+    currency = Config::STARTING_MONEY;
+    customerRating = Config::STARTING_RATING;
+    
+    // Add starting items to inventory
+    inventory->addItem("Tomato Seeds", "seed", 10, 8);
+    inventory->addItem("Basil Seeds", "seed", 10, 5);
+    inventory->addItem("Nutrient Pack", "nutrient", 3, 50);
+    
+    // Hire one starting worker
+    Worker* starter = new Worker(1, "Bob");
+    starter->addRole(new WatererRole(starter));
+    workers.push_back(starter);
+    workScheduler->registerWorker(starter);
+    
+    LOG_INFO(SIM, "✓ Starting balance: $" << currency);
+    LOG_INFO(SIM, "✓ Starting rating: " << customerRating << " stars");
+    LOG_INFO(SIM, "✓ Greenhouse size: " << greenhouseWidth << "x" << greenhouseHeight);
+    LOG_INFO(SIM, "✓ Starting worker: " << starter->getName());
+    
+    // Create initial snapshot
+    saveSnapshot();
+}
+
+void Simulation::update(float tickSeconds) {
+    // Pause freezes the whole simulation (TimeManager is authoritative)
+    if (timeManager->getIsPaused()) {
+        return;
+    }
+    
+    if (recorder != nullptr) {
+        recorder->recordTick(tickSeconds);
+    }
+    
+    // Time warp: one real tick covers warpFactor ticks of game time
+    advanceSteps(tickSeconds * timeManager->getWarpFactor(), Config::WARP_MAX_STEP_SECONDS);
+}
+
+void Simulation::advance(double gameSeconds, float maxStepSeconds) {
+    if (timeManager->getIsPaused() || maxStepSeconds <= 0.0f) {
+        return;
+    }
+    
+    if (recorder != nullptr) {
+        recorder->recordAdvance(gameSeconds, maxStepSeconds);
+    }
+    advanceSteps(gameSeconds, maxStepSeconds);
+}
+
+void Simulation::advanceSteps(double gameSeconds, float maxStepSeconds) {
+    // Split large spans into bounded steps so plant thresholds,
+    // worker timers and customer timeouts stay accurate under warp
+    double remaining = gameSeconds;
+    while (remaining > 0.0) {
+        float deltaTime = static_cast<float>(std::min(remaining, static_cast<double>(maxStepSeconds)));
+        step(deltaTime);
+        remaining -= deltaTime;
+    }
+}
+
+void Simulation::step(float deltaTime) {
+    stepCount++;
+    
+    // A reload changed the rates the sleeping plants' wake ticks were
+    // computed from. Catch every plant up and reschedule it before the
+    // replaced version can be reclaimed
+    uint64_t generation = PlantTypeDatabase::getGeneration();
+    if (generation != catalogGeneration) {
+        catalogGeneration = generation;
+        rescheduleAllPlants();
+    }
+    
+    // No plant update is in flight between steps, so catalog versions
+    // replaced by a reload can no longer be referenced
+    PlantTypeDatabase::getInstance()->reclaimRetired();
+    
+    // Update time
+    timeManager->update(deltaTime);
+    
+    // Update timers
+    customerSpawnTimer += deltaTime;
+    dayTimer += deltaTime;
+    
+    // Update game systems
+    {
+        FrameProfiler::Scope scope(ProfilePhase::PLANTS);
+        updatePlants(deltaTime);
+    }
+    {
+        FrameProfiler::Scope scope(ProfilePhase::WORKERS);
+        updateWorkers(deltaTime);
+    }
+    {
+        FrameProfiler::Scope scope(ProfilePhase::CUSTOMERS);
+        processCustomers(deltaTime);
+    }
+    
+    // Spawn customers periodically (catch up if a step spans several intervals)
+    int arrivals = 0;
+    while (customerSpawnTimer >= Config::CUSTOMER_SPAWN_INTERVAL) {
+        customerSpawnTimer -= Config::CUSTOMER_SPAWN_INTERVAL;
+        arrivals++;
+    }
+    if (arrivals > 0) {
+        FrameProfiler::Scope scope(ProfilePhase::SPAWN);
+        spawnCustomers(arrivals);
+    }
+    
+    // Check for day end (once per midnight crossed)
+    for (int i = 0; i < timeManager->getDaysAdvanced(); i++) {
+        FrameProfiler::Scope scope(ProfilePhase::DAY_END);
+        checkDayEnd();
+    }
+    
+    runDeferredWork();
+}
+
+const FrameBudget* Simulation::getDeferralBudget() const {
+    // Recorded sessions must replay identically, so nothing depends on
+    // wall time while recording
+    if (recorder != nullptr || !frameBudget->isEnabled()) {
+        return nullptr;
+    }
+    return frameBudget;
+}
+
+void Simulation::runDeferredWork() {
+    if (pendingSnapshot.active) {
+        FrameProfiler::Scope scope(ProfilePhase::DAY_END);
+        continueSnapshot(getDeferralBudget());
+    }
+}
+
+Plant* Simulation::getPlantAt(int x, int y) const {
+    if (x < 0 || x >= greenhouseWidth || y < 0 || y >= greenhouseHeight) {
+        return nullptr;
+    }
+    
+    size_t index = static_cast<size_t>(y * greenhouseWidth + x);
+    return index < plants.size() ? plants[index] : nullptr;
+}
+
+// ============================================
+// MEMENTO PATTERN: ORIGINATOR METHODS
+// ============================================
+
+void Simulation::createSnapshot() {
+    if (recorder != nullptr) {
+        recorder->recordSnapshot(SessionOp::SNAPSHOT);
+    }
+    saveSnapshot();
+}
+
+void Simulation::saveSnapshot() {
+    beginSnapshot();
+    finishSnapshot();
+}
+
+void Simulation::beginSnapshot() {
+    finishSnapshot();  // Keep snapshots in order
+    
+    // Create GameData from current state
+    GameData& data = pendingSnapshot.data;
+    data = GameData();
+    
+    // Time
+    data.time = TimeData(
+        timeManager->getCurrentDay(), 
+        timeManager->getCurrentHour(), 
+        timeManager->getCurrentMinute()
+    );
+    
+    // Economy
+    data.economy = EconomyData(currency, customerRating);
+    
+    // Greenhouse
+    data.greenhouse = GreenhouseData(greenhouseWidth, greenhouseHeight);
+    
+    // Capture plants (bring sleeping plants up to date first); turning
+    // them into PlantData is the slow part and is left to continueSnapshot
+    syncAllPlants();
+    pendingSnapshot.plants.clear();
+    for (Plant* plant : plants) {
+        if (plant != nullptr) {
+            pendingSnapshot.plants.push_back(plant->capture());
+        }
+    }
+    pendingSnapshot.next = 0;
+    pendingSnapshot.active = true;
+    
+    // Serialize workers
+    for (Worker* worker : workers) {
+        data.workers.push_back(worker->serialize());
+    }
+    
+    // Statistics
+    data.statistics.totalPlantsGrown = totalPlantsGrown;
+    data.statistics.totalCustomersServed = totalCustomersServed;
+    data.statistics.totalMoneyEarned = totalMoneyEarned;
+    
+    data.generateSaveName();
+    data.generateTimestamp();
+    data.greenhouse.plants.reserve(pendingSnapshot.plants.size());
+}
+
+void Simulation::continueSnapshot(const FrameBudget* budget) {
+    GameData& data = pendingSnapshot.data;
+    size_t count = pendingSnapshot.plants.size();
+    
+    // At least one slice per call, so the snapshot completes even when
+    // every frame is over budget
+    while (pendingSnapshot.next < count) {
+        size_t end = std::min(count, pendingSnapshot.next + Config::SNAPSHOT_SLICE_PLANTS);
+        for (size_t i = pendingSnapshot.next; i < end; i++) {
+            data.greenhouse.plants.push_back(Plant::serialize(pendingSnapshot.plants[i]));
+        }
+        pendingSnapshot.next = end;
+        
+        if (pendingSnapshot.next < count && budget != nullptr && budget->isExhausted()) {
+            budget->noteDeferred();
+            return;
+        }
+    }
+    
+    // Create memento and save to caretaker
+    GameMemento memento(data);
+    caretaker->saveMemento(memento);
+    pendingSnapshot.active = false;
+    
+    LOG_INFO(SIM, "📸 Game snapshot created: " << data.saveName);
+    data = GameData();  // The memento has its own copy
+}
+
+void Simulation::finishSnapshot() {
+    if (pendingSnapshot.active) {
+        continueSnapshot(nullptr);
+    }
+}
+
+void Simulation::restoreSnapshot(int index) {
+    if (recorder != nullptr) {
+        recorder->recordSnapshot(SessionOp::RESTORE, index);
+    }
+    loadSnapshot(index);
+}
+
+void Simulation::loadSnapshot(int index) {
+    finishSnapshot();  // Indices count the pending one
+    
+    try {
+        GameMemento memento = caretaker->getMemento(index);
+        const GameData& data = memento.getState();
+        
+        LOG_INFO(SIM, "\n📂 Restoring snapshot: " << data.saveName);
+        
+        // Restore economy
+        currency = data.economy.currency;
+        customerRating = data.economy.rating;
+        
+        // Restore time
+        timeManager->setDay(data.time.day);
+        timeManager->setTime(data.time.hour, data.time.minute);
+        
+        // Clear and restore plants
+        plantStore->clear();
+        plants.assign(greenhouseWidth * greenhouseHeight, nullptr);
+        
+        resetPlantSchedule();
+        
+        for (const PlantData& pd : data.greenhouse.plants) {
+            int index = pd.posY * greenhouseWidth + pd.posX;
+            if (index >= 0 && index < static_cast<int>(plants.size())) {
+                plants[index] = Plant::deserialize(pd, *plantStore, index);
+                nextPlantId = std::max(nextPlantId, pd.id + 1);
+                schedulePlant(index);
+            }
+        }
+        
+        // Clear and restore workers
+        for (Worker* worker : workers) {
+            workScheduler->unregisterWorker(worker);  // Scheduler must not keep the old pointers
+            delete worker;
+        }
+        workers.clear();
+        
+        for (const WorkerData& wd : data.workers) {
+            Worker* worker = Worker::deserialize(wd);
+            workers.push_back(worker);
+            workScheduler->registerWorker(worker);
+        }
+        
+        // Restore statistics
+        totalPlantsGrown = data.statistics.totalPlantsGrown;
+        totalCustomersServed = data.statistics.totalCustomersServed;
+        totalMoneyEarned = data.statistics.totalMoneyEarned;
+        
+        LOG_INFO(SIM, "✅ Snapshot restored successfully!");
+        data.printSummary();
+        
+    } catch (const std::exception& e) {
+        LOG_ERROR(SIM, "❌ Failed to restore snapshot: " << e.what());
+    }
+}
+
+void Simulation::undoToLastSnapshot() {
+    if (recorder != nullptr) {
+        recorder->recordSnapshot(SessionOp::UNDO);
+    }
+    
+    finishSnapshot();
+    
+    try {
+        GameMemento memento = caretaker->undo();
+        LOG_INFO(SIM, "\n⏪ Undoing to previous state...");
+        
+        // Get the new "current" state after undo
+        int newIndex = caretaker->getSnapshotCount() - 1;
+        loadSnapshot(newIndex);
+        
+    } catch (const std::exception& e) {
+        LOG_ERROR(SIM, "❌ Cannot undo: " << e.what());
+    }
+}
+
+void Simulation::listSnapshots() const {
+    caretaker->listSnapshots();
+}
+
+// ============================================
+// PLAYER ACTIONS
+// ============================================
+
+bool Simulation::plantSeed(PlantType type, int x, int y) {
+    if (recorder != nullptr) {
+        recorder->recordPlant(type, x, y);
+    }
+    
+    if (x < 0 || x >= greenhouseWidth || y < 0 || y >= greenhouseHeight) {
+        return false;
+    }
+    
+    int index = y * greenhouseWidth + x;
+    if (plants[index] != nullptr) {
+        LOG_WARN(SIM, "❌ Tile already occupied!");
+        return false;
+    }
+    
+    PlantTypeDatabase* db = PlantTypeDatabase::getInstance();
+    const PlantTypeInfo& info = db->getPlantInfo(type);
+    
+    if (currency < info.seedCost) {
+        LOG_WARN(SIM, "❌ Not enough money! Need $" << info.seedCost);
+        return false;
+    }
+    
+    currency -= info.seedCost;
+    
+    plants[index] = plantStore->create(index, nextPlantId++, type, x, y);
+    
+    // Start tracking its next event
+    plantLastUpdate[index] = plantClock;
+    schedulePlant(index);
+    
+    LOG_INFO(SIM, "✅ Planted " << info.name << " at (" << x << ", " << y << ")");
+    return true;
+}
+
+bool Simulation::waterPlant(int x, int y) {
+    if (recorder != nullptr) {
+        recorder->recordTile(SessionOp::WATER, x, y);
+    }
+    
+    if (x < 0 || x >= greenhouseWidth || y < 0 || y >= greenhouseHeight) {
+        return false;
+    }
+    
+    int index = y * greenhouseWidth + x;
+    Plant* plant = plants[index];
+    
+    if (plant == nullptr) {
+        LOG_WARN(SIM, "❌ No plant at this location!");
+        return false;
+    }
+    
+    syncPlant(index);
+    plant->water();
+    schedulePlant(index);  // Water level reset moves the next threshold
+    LOG_INFO(SIM, "💧 Watered " << plant->getPlantTypeInfo().name);
+    return true;
+}
+
+bool Simulation::harvestPlant(int x, int y) {
+    if (recorder != nullptr) {
+        recorder->recordTile(SessionOp::HARVEST, x, y);
+    }
+    
+    if (x < 0 || x >= greenhouseWidth || y < 0 || y >= greenhouseHeight) {
+        return false;
+    }
+    
+    int index = y * greenhouseWidth + x;
+    Plant* plant = plants[index];
+    
+    if (plant == nullptr) {
+        LOG_WARN(SIM, "❌ No plant at this location!");
+        return false;
+    }
+    
+    syncPlant(index);
+    
+    if (!plant->canHarvest()) {
+        LOG_WARN(SIM, "❌ Plant is not ready to harvest!");
+        return false;
+    }
+    
+    int value = 0;
+    if (plant->harvest(value)) {
+        currency += value;
+        totalMoneyEarned += value;
+        totalPlantsGrown++;
+        
+        // Add to inventory
+        std::string plantName = plant->getPlantTypeInfo().name;
+        inventory->addItem(plantName, "plant", 1, value);
+        
+        LOG_INFO(SIM, "🌾 Harvested " << plantName << " for $" << value);
+        
+        // Remove plant
+        plantStore->remove(index);
+        plants[index] = nullptr;
+        plantWakeTick[index] = NO_WAKE;  // Any queued wheel entry is now stale
+        
+        return true;
+    }
+    
+    return false;
+}
+
+bool Simulation::hireWorker(const std::string& name) {
+    if (recorder != nullptr) {
+        recorder->recordText(SessionOp::HIRE, name);
+    }
+    
+    if (currency < Config::WORKER_HIRE_COST) {
+        LOG_WARN(SIM, "❌ Not enough money to hire worker!");
+        return false;
+    }
+    
+    currency -= Config::WORKER_HIRE_COST;
+    
+    int workerId = static_cast<int>(workers.size()) + 1;
+    Worker* newWorker = new Worker(workerId, name);
+    workers.push_back(newWorker);
+    workScheduler->registerWorker(newWorker);
+    
+    LOG_INFO(SIM, "✅ Hired " << name << " as worker #" << workerId);
+    return true;
+}
+
+bool Simulation::buyItem(const std::string& itemName) {
+    if (recorder != nullptr) {
+        recorder->recordText(SessionOp::BUY, itemName);
+    }
+    
+    // TODO: Implement shop
+    return false;
+}
+
+void Simulation::spawnCustomers(int count) {
+    spawnBuffer.resize(count);
+    CustomerFactory::createRandomCustomers(spawnBuffer.data(), count);
+    for (Customer* customer : spawnBuffer) {
+        customerQueue.push(customer);
+    }
+}
+
+void Simulation::processCustomers(float deltaTime) {
+    // Update all customers in queue
+    std::queue<Customer*> updatedQueue;
+    
+    while (!customerQueue.empty()) {
+        Customer* customer = customerQueue.front();
+        customerQueue.pop();
+        
+        customer->update(deltaTime);
+        
+        if (customer->hasTimedOut() || customer->isServed()) {
+            if (customer->hasTimedOut()) {
+                customerRating -= Config::RATING_TIMEOUT_PENALTY;
+            }
+            delete customer;
+        } else {
+            updatedQueue.push(customer);
+        }
+    }
+    
+    customerQueue = updatedQueue;
+}
+
+void Simulation::updatePlants(float deltaTime) {
+    // Only plants whose next event is due are woken; the rest sleep
+    plantClock += deltaTime;
+    plantStore->setCurrentMinutes(timeManager->getGameMinutes());  // One timestamp per tick
+    uint64_t targetTick = static_cast<uint64_t>(plantClock / Config::PLANT_WHEEL_TICK_SECONDS);
+    
+    duePlants.clear();
+    plantWheel.advance(targetTick, duePlants);
+    
+    wokenPlants.clear();
+    wokenElapsed.clear();
+    for (const TimingWheel::Entry& entry : duePlants) {
+        int index = static_cast<int>(entry.id);
+        
+        // Skip entries superseded by a reschedule or a removed plant
+        if (plants[index] == nullptr || plantWakeTick[index] != entry.dueTick) {
+            continue;
+        }
+        
+        plantWakeTick[index] = NO_WAKE;  // Consumed: a tile is woken at most once
+        
+        // Rates are constant between events, so one catch-up step is exact
+        double elapsed = plantClock - plantLastUpdate[index];
+        plantLastUpdate[index] = plantClock;
+        if (elapsed > 0.0) {
+            wokenPlants.push_back(index);
+            wokenElapsed.push_back(static_cast<float>(elapsed));
+        } else {
+            schedulePlant(index);
+        }
+    }
+    
+    int count = static_cast<int>(wokenPlants.size());
+    if (plantPool != nullptr && count >= Config::PLANT_PARALLEL_MIN_BATCH) {
+        syncPlantsParallel();
+    } else {
+        syncWokenPlants(0, count);
+    }
+    
+    // The wheel is single-threaded; reschedule in wake order
+    for (int index : wokenPlants) {
+        schedulePlant(index);
+    }
+}
+
+void Simulation::syncWokenPlants(int begin, int end) {
+    // Batched kernel update; events come out in wake order
+    plantStore->advance(wokenPlants.data() + begin, wokenElapsed.data() + begin, end - begin);
+}
+
+void Simulation::syncPlantsParallel() {
+    int count = static_cast<int>(wokenPlants.size());
+    int chunkCount = (count + Config::PLANT_CHUNK_SIZE - 1) / Config::PLANT_CHUNK_SIZE;
+    
+    if (static_cast<int>(plantEventBuffers.size()) < chunkCount) {
+        plantEventBuffers.resize(chunkCount);
+    }
+    
+    // Each chunk touches only its own tiles and its own event buffer
+    plantPool->parallelFor(chunkCount, [this, count](int chunk) {
+        int begin = chunk * Config::PLANT_CHUNK_SIZE;
+        int end = std::min(begin + Config::PLANT_CHUNK_SIZE, count);
+        
+        PlantEventBuffer::setThreadBuffer(&plantEventBuffers[chunk]);
+        syncWokenPlants(begin, end);
+        PlantEventBuffer::setThreadBuffer(nullptr);
+    });
+    
+    // Deliver events in chunk order: identical to the serial sequence
+    for (int chunk = 0; chunk < chunkCount; chunk++) {
+        plantEventBuffers[chunk].dispatch();
+    }
+}
+
+void Simulation::resetPlantSchedule() {
+    plantWheel.clear();
+    plantClock = 0.0;
+    plantStore->setCurrentMinutes(timeManager->getGameMinutes());
+    plantLastUpdate.assign(plants.size(), 0.0);
+    plantWakeTick.assign(plants.size(), NO_WAKE);
+}
+
+void Simulation::schedulePlant(int index) {
+    float delay = plants[index]->getTimeUntilNextEvent();
+    
+    // Nothing ahead (dead plants, growth stalled without water): no wake.
+    // Anything that changes a plant from outside (planting, watering,
+    // restoring, a catalog reload) resyncs and reschedules it
+    if (delay == std::numeric_limits<float>::infinity()) {
+        plantWakeTick[index] = NO_WAKE;
+        return;
+    }
+    
+    // Round down so the catch-up step ends just before a threshold,
+    // keeping each interval's rates constant. Past the wheel's range the
+    // plant wakes early and reschedules (the wheel would clamp the tick,
+    // and a clamped entry would no longer match plantWakeTick)
+    uint64_t currentTick = plantWheel.getCurrentTick();
+    double dueTime = std::max(0.0, (plantClock + delay) / Config::PLANT_WHEEL_TICK_SECONDS);
+    double lastTick = static_cast<double>(currentTick + TimingWheel::getMaxDelay());
+    uint64_t dueTick = static_cast<uint64_t>(std::min(dueTime, lastTick));
+    dueTick = std::max(dueTick, currentTick + 1);
+    
+    plantWakeTick[index] = dueTick;
+    plantWheel.schedule(static_cast<uint32_t>(index), dueTick);
+}
+
+void Simulation::syncPlant(int index) {
+    // Rates are constant between events, so one catch-up step is exact
+    double elapsed = plantClock - plantLastUpdate[index];
+    if (elapsed > 0.0) {
+        plants[index]->update(static_cast<float>(elapsed));
+    }
+    plantLastUpdate[index] = plantClock;
+}
+
+void Simulation::syncAllPlants() {
+    // Same catch-up as syncPlant for every tile, through the batch kernel.
+    // Runs between plant updates, so the wake buffers are free to reuse;
+    // wheel entries stay valid (a later wake just catches up less)
+    wokenPlants.clear();
+    wokenElapsed.clear();
+    for (int index = 0; index < static_cast<int>(plants.size()); index++) {
+        if (plants[index] == nullptr) {
+            continue;
+        }
+        double elapsed = plantClock - plantLastUpdate[index];
+        plantLastUpdate[index] = plantClock;
+        if (elapsed > 0.0) {
+            wokenPlants.push_back(index);
+            wokenElapsed.push_back(static_cast<float>(elapsed));
+        }
+    }
+    
+    int count = static_cast<int>(wokenPlants.size());
+    if (plantPool != nullptr && count >= Config::PLANT_PARALLEL_MIN_BATCH) {
+        syncPlantsParallel();
+    } else {
+        syncWokenPlants(0, count);
+    }
+}
+
+void Simulation::rescheduleAllPlants() {
+    // Earlier wheel entries no longer match plantWakeTick and are skipped
+    syncAllPlants();
+    for (int index = 0; index < static_cast<int>(plants.size()); index++) {
+        if (plants[index] != nullptr) {
+            schedulePlant(index);
+        }
+    }
+}
+
+Plant* Simulation::syncPlantAt(int x, int y) {
+    Plant* plant = getPlantAt(x, y);
+    int index = y * greenhouseWidth + x;
+    // Nothing to catch up (and nothing to record) if no game time passed
+    if (plant != nullptr && plantClock - plantLastUpdate[index] > 0.0) {
+        if (recorder != nullptr) {
+            recorder->recordTile(SessionOp::SYNC, x, y);
+        }
+        syncPlant(index);
+    }
+    return plant;
+}
+
+void Simulation::updateWorkers(float deltaTime) {
+    workScheduler->updateAllWorkers(deltaTime, getDeferralBudget());
+}
+
+void Simulation::checkDayEnd() {
+    LOG_INFO(SIM, "\n🌙 End of Day " << timeManager->getCurrentDay());
+    workScheduler->payAllWorkers(currency);
+    
+    // Tasks for plants harvested or watered since they were queued
+    workScheduler->discardStaleTasks();
+    
+    // Auto-create snapshot at end of day; under a frame budget its
+    // serialization continues in later steps
+    beginSnapshot();
+}
+
+// ============================================
+// RECORD / REPLAY
+// ============================================
+
+void Simulation::setWarpFactor(float factor) {
+    if (recorder != nullptr) {
+        recorder->recordWarp(factor);
+    }
+    timeManager->setWarpFactor(factor);
+}
+
+void Simulation::setCurrency(double amount) {
+    if (recorder != nullptr) {
+        recorder->recordCurrency(amount);
+    }
+    currency = amount;
+}
+
+void Simulation::applySessionEvent(const SessionEvent& event) {
+    switch (event.op) {
+        case SessionOp::TICK:
+            for (uint32_t i = 0; i < event.count; i++) {
+                update(event.seconds);
+            }
+            break;
+        case SessionOp::ADVANCE:  advance(event.value, event.seconds); break;
+        case SessionOp::PLANT:    plantSeed(event.plantType, event.x, event.y); break;
+        case SessionOp::WATER:    waterPlant(event.x, event.y); break;
+        case SessionOp::HARVEST:  harvestPlant(event.x, event.y); break;
+        case SessionOp::HIRE:     hireWorker(event.text); break;
+        case SessionOp::BUY:      buyItem(event.text); break;
+        case SessionOp::WARP:     setWarpFactor(event.seconds); break;
+        case SessionOp::CURRENCY: setCurrency(event.value); break;
+        case SessionOp::SNAPSHOT: createSnapshot(); break;
+        case SessionOp::RESTORE:  restoreSnapshot(event.x); break;
+        case SessionOp::UNDO:     undoToLastSnapshot(); break;
+        case SessionOp::SYNC:     syncPlantAt(event.x, event.y); break;
+        case SessionOp::END:      break;
+    }
+}
+
+uint64_t Simulation::getStateHash() const {
+    StateHash hash;
+    hash.add(currency);
+    hash.add(customerRating);
+    hash.add(timeManager->getGameMinutes());
+    hash.add(plantClock);
+    hash.add(stepCount);
+    hash.add(totalPlantsGrown);
+    hash.add(totalCustomersServed);
+    hash.add(totalMoneyEarned);
+    hash.add(customerQueue.size());
+    
+    for (size_t i = 0; i < plants.size(); i++) {
+        const Plant* plant = plants[i];
+        if (plant == nullptr) {
+            continue;
+        }
+        hash.add(i);
+        hash.add(plant->getPlantType());
+        hash.add(plant->getStateId());
+        hash.add(plant->getGrowthProgress());
+        hash.add(plant->getWaterLevel());
+        hash.add(plant->getDecayTimer());
+    }
+    
+    for (const Worker* worker : workers) {
+        WorkerData data = worker->serialize();
+        hash.add(data.id);
+        hash.add(data.name);
+        hash.add(data.experience);
+        hash.add(data.overallLevel);
+        hash.add(worker->getTaskCount());
+    }
+    return hash.get();
+}
+
+
+// ============================================
+// METRICS
+// ============================================
+
+void Simulation::registerMetrics(MetricsRegistry* metrics) {
+    metricIds.taskQueueDepth = metrics->addGauge("templanter_task_queue_depth",
+        "Tasks waiting in the WorkScheduler global queue.");
+    metricIds.customerQueueLength = metrics->addGauge("templanter_customer_queue_length",
+        "Customers waiting to be served.");
+    metricIds.workersIdle = metrics->addGauge("templanter_workers", "Workers by activity.", "state=\"idle\"");
+    metricIds.workersBusy = metrics->addGauge("templanter_workers", "Workers by activity.", "state=\"busy\"");
+    metricIds.snapshots = metrics->addGauge("templanter_snapshots", "Snapshots held by the Caretaker.");
+    metricIds.snapshotBytes = metrics->addGauge("templanter_snapshot_bytes",
+        "Approximate memory held by Caretaker snapshots.");
+    metricIds.steps = metrics->addCounter("templanter_sim_steps_total",
+        "Simulation steps run (a warped tick runs several).");
+    metricIds.stepRate = metrics->addGauge("templanter_sim_steps_per_second",
+        "Simulation steps per wall-clock second since the last publish.");
+    for (int i = 0; i < static_cast<int>(PlantStateId::COUNT); i++) {
+        std::string label = std::string("state=\"") + PlantState::getName(static_cast<PlantStateId>(i)) + "\"";
+        metricIds.plants[i] = metrics->addGauge("templanter_plants", "Planted tiles by plant state.", label);
+    }
+    metricIds.registered = true;
+}
+
+void Simulation::collectMetrics(MetricsRegistry* metrics) {
+    if (!metricIds.registered) {
+        registerMetrics(metrics);
+    }
+    
+    int idleWorkers = workScheduler->getAvailableWorkerCount();
+    metrics->set(metricIds.taskQueueDepth, workScheduler->getQueuedTaskCount());
+    metrics->set(metricIds.customerQueueLength, static_cast<double>(customerQueue.size()));
+    metrics->set(metricIds.workersIdle, idleWorkers);
+    metrics->set(metricIds.workersBusy, static_cast<double>(workers.size()) - idleWorkers);
+    metrics->set(metricIds.snapshots, caretaker->getSnapshotCount());
+    metrics->set(metricIds.snapshotBytes, static_cast<double>(caretaker->getSnapshotBytes()));
+    
+    double seconds = metrics->getSecondsSinceLastPublish();
+    metrics->set(metricIds.steps, static_cast<double>(stepCount));
+    metrics->set(metricIds.stepRate, seconds > 0.0 ? (stepCount - lastMetricsStepCount) / seconds : 0.0);
+    lastMetricsStepCount = stepCount;
+    
+    int plantCounts[static_cast<int>(PlantStateId::COUNT)];
+    plantStore->countByState(plantCounts);
+    for (int i = 0; i < static_cast<int>(PlantStateId::COUNT); i++) {
+        metrics->set(metricIds.plants[i], plantCounts[i]);
+    }
+}
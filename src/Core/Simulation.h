@@ -0,0 +1,209 @@
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include <vector>
+#include <queue>
+#include <string>
+#include "TimeManager.h"
+#include "TimingWheel.h"
+#include "ThreadPool.h"
+#include "SaveManager.h"
+#include "Config.h"
+#include "Patterns/Memento/Caretaker.h"
+#include "Patterns/Memento/GameMemento.h"
+#include "Greenhouse/Plant.h"
+#include "Greenhouse/PlantStore.h"
+#include "Patterns/Observer/PlantSubject.h"
+#include "SessionLog.h"
+
+// Forward declarations
+class Plant;
+class Worker;
+class Customer;
+class WorkScheduler;
+class StorageContainer;
+class Inventory;
+class MetricsRegistry;
+class FrameBudget;
+
+// ============================================
+// SIMULATION (Originator in Memento Pattern)
+// ============================================
+// Owns all game state and the per-tick update logic.
+// Contains no SFML code so it can run without a window (headless driver,
+// batch servers). GameManager wraps it with input handling and rendering.
+class Simulation {
+private:
+    static constexpr uint64_t NO_WAKE = UINT64_MAX;  // Tile has no scheduled wake
+    
+    // Core managers
+    TimeManager* timeManager;
+    SaveManager* saveManager;
+    WorkScheduler* workScheduler;
+    Caretaker* caretaker;  // Memento Pattern: Caretaker
+
+    // Game data
+    double currency;
+    double customerRating;
+    int greenhouseWidth;
+    int greenhouseHeight;
+    PlantStore* plantStore;             // Plant data (structure of arrays)
+    std::vector<Plant*> plants;         // Per tile: handle into plantStore, or nullptr
+    int nextPlantId;                    // Ids are never reused, so stale tasks can tell a replant apart
+    std::vector<Worker*> workers;
+    std::queue<Customer*> customerQueue;
+    std::vector<Customer*> spawnBuffer;  // Reused for bulk arrivals
+    
+    // Plant event scheduler: plants sleep until their next transition
+    // or water threshold instead of being updated every tick
+    TimingWheel plantWheel;
+    double plantClock;                          // Simulated seconds (plant timebase)
+    std::vector<double> plantLastUpdate;        // Per tile: plantClock at last catch-up
+    std::vector<uint64_t> plantWakeTick;        // Per tile: live due tick (lazy cancellation)
+    uint64_t catalogGeneration;                 // Catalog version the wake ticks were computed with
+    std::vector<TimingWheel::Entry> duePlants;  // Reused expiry buffer
+    std::vector<int> wokenPlants;               // Reused: live tiles woken this step
+    std::vector<float> wokenElapsed;            // Reused: catch-up span per woken tile
+    
+    // Parallel plant update: woken plants are split into chunks, each
+    // chunk buffers its observer events, and buffers are dispatched in
+    // chunk order so the scheduler sees the same sequence as a serial run
+    ThreadPool* plantPool;                      // nullptr = single-threaded
+    std::vector<PlantEventBuffer> plantEventBuffers;
+
+    // Storage & Inventory
+    StorageContainer* mainStorage;
+    Inventory* inventory;
+
+    // Timers
+    float customerSpawnTimer;
+    float dayTimer;
+
+    // Statistics
+    int totalPlantsGrown;
+    int totalCustomersServed;
+    double totalMoneyEarned;
+    uint64_t stepCount;
+    
+    // Record / replay
+    uint64_t seed;                  // Session seed (recorded with the log)
+    SessionRecorder* recorder;      // Not owned; nullptr = not recording
+
+    // Metric ids in the registry, filled by the first collectMetrics call
+    struct MetricIds {
+        bool registered;
+        int taskQueueDepth;
+        int customerQueueLength;
+        int workersIdle;
+        int workersBusy;
+        int snapshots;
+        int snapshotBytes;
+        int steps;
+        int stepRate;
+        int plants[static_cast<int>(PlantStateId::COUNT)];
+    };
+    MetricIds metricIds;
+    uint64_t lastMetricsStepCount;
+    
+    // Frame budget: a day-end snapshot is captured at once but its plants
+    // are serialized in slices that may spill into later frames
+    struct PendingSnapshot {
+        bool active;
+        GameData data;                    // Everything but the plants
+        std::vector<PlantRecord> plants;  // Captured at day end
+        size_t next;                      // Plants serialized so far
+    };
+    PendingSnapshot pendingSnapshot;
+    FrameBudget* frameBudget;
+
+    // Game logic
+    void step(float deltaTime);  // One bounded simulation step
+    void advanceSteps(double gameSeconds, float maxStepSeconds);
+    void saveSnapshot();         // Unrecorded snapshot (day end, new game)
+    void beginSnapshot();        // Captures the state; serialization may be deferred
+    void continueSnapshot(const FrameBudget* budget);  // nullptr = run to completion
+    void finishSnapshot();       // Completes a pending snapshot now
+    const FrameBudget* getDeferralBudget() const;  // nullptr while recording or unbudgeted
+    void runDeferredWork();
+    void loadSnapshot(int index);
+    void spawnCustomers(int count);
+    void processCustomers(float deltaTime);
+    void updatePlants(float deltaTime);
+    void resetPlantSchedule();
+    void schedulePlant(int index);
+    void syncPlant(int index);
+    void syncAllPlants();  // syncPlant on every tile, batched
+    void rescheduleAllPlants();
+    void syncWokenPlants(int begin, int end);
+    void syncPlantsParallel();
+    void updateWorkers(float deltaTime);
+    void checkDayEnd();
+    void registerMetrics(MetricsRegistry* metrics);
+
+public:
+    Simulation(int width = Config::INITIAL_GRID_WIDTH, int height = Config::INITIAL_GRID_HEIGHT,
+               int workerThreads = Config::SIM_WORKER_THREADS);
+    ~Simulation();
+
+    // Delete copy constructor and assignment
+    Simulation(const Simulation&) = delete;
+    Simulation& operator=(const Simulation&) = delete;
+
+    // Lifecycle
+    void initialize();
+    void update(float tickSeconds);  // Advance by one fixed tick (scaled by warp factor)
+    
+    // Time warp: advance by a large game-time span in batched steps
+    void advance(double gameSeconds, float maxStepSeconds = Config::WARP_MAX_STEP_SECONDS);
+    void setWarpFactor(float factor);
+    float getWarpFactor() const { return timeManager->getWarpFactor(); }
+
+    // Memento Pattern: Originator methods
+    void createSnapshot();
+    void restoreSnapshot(int index);
+    void undoToLastSnapshot();
+    void listSnapshots() const;
+
+    // Player actions
+    bool plantSeed(PlantType type, int x, int y);
+    bool waterPlant(int x, int y);
+    bool harvestPlant(int x, int y);
+    bool hireWorker(const std::string& name);
+    bool buyItem(const std::string& itemName);
+
+    // Getters
+    double getCurrency() const { return currency; }
+    double getRating() const { return customerRating; }
+    int getGreenhouseWidth() const { return greenhouseWidth; }
+    int getGreenhouseHeight() const { return greenhouseHeight; }
+    Plant* getPlantAt(int x, int y) const;
+    Plant* syncPlantAt(int x, int y);  // Brings a sleeping plant's growth/water up to date
+    const std::vector<Plant*>& getPlants() const { return plants; }
+    int getPlantCount() const { return plantStore->getCount(); }
+    int getWorkerCount() const { return static_cast<int>(workers.size()); }
+    int getCustomerCount() const { return static_cast<int>(customerQueue.size()); }
+    int getSnapshotCount() const { return caretaker->getSnapshotCount(); }
+    bool hasPendingSnapshot() const { return pendingSnapshot.active; }
+    int getWorkerThreadCount() const { return plantPool ? plantPool->getThreadCount() : 1; }
+    TimeManager* getTimeManager() const { return timeManager; }
+
+    // Copy queue depths, worker utilisation, snapshot and plant counts
+    // into the registry (call just before MetricsRegistry::publish)
+    void collectMetrics(MetricsRegistry* metrics);
+
+    // Record / replay: public actions and ticks are written to the
+    // recorder; applySessionEvent performs one recorded record
+    void setRecorder(SessionRecorder* sessionRecorder) { recorder = sessionRecorder; }
+    void applySessionEvent(const SessionEvent& event);
+    void setSeed(uint64_t sessionSeed) { seed = sessionSeed; }
+    uint64_t getSeed() const { return seed; }
+    
+    // Hash of economy, time, plants, workers and customers for comparing
+    // a replay with its recording (does not sync sleeping plants)
+    uint64_t getStateHash() const;
+
+    // Setters (for headless runs and test harnesses)
+    void setCurrency(double amount);
+};
+
+#endif // SIMULATION_H
@@ -0,0 +1,93 @@
+#include "ThreadPool.h"
+
+ThreadPool::ThreadPool(int threadCount)
+    : job(nullptr), jobCount(0), nextIndex(0), pendingWorkers(0),
+      generation(0), stopping(false) {
+    
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::thread::hardware_concurrency());
+    }
+    
+    // Calling thread is one of the workers
+    for (int i = 1; i < threadCount; i++) {
+        threads.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    workReady.notify_all();
+    
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void ThreadPool::parallelFor(int count, const std::function<void(int)>& fn) {
+    if (count <= 0) {
+        return;
+    }
+    
+    // Nothing to share the work with
+    if (threads.empty() || count == 1) {
+        for (int i = 0; i < count; i++) {
+            fn(i);
+        }
+        return;
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        job = &fn;
+        jobCount = count;
+        nextIndex = 0;
+        pendingWorkers = static_cast<int>(threads.size());
+        generation++;
+    }
+    workReady.notify_all();
+    
+    runJobs(fn, count);
+    
+    std::unique_lock<std::mutex> lock(mutex);
+    workDone.wait(lock, [this] { return pendingWorkers == 0; });
+    job = nullptr;
+}
+
+void ThreadPool::workerLoop() {
+    uint64_t seenGeneration = 0;
+    
+    while (true) {
+        const std::function<void(int)>* currentJob;
+        int count;
+        
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            workReady.wait(lock, [&] { return stopping || generation != seenGeneration; });
+            if (stopping) {
+                return;
+            }
+            seenGeneration = generation;
+            currentJob = job;
+            count = jobCount;
+        }
+        
+        runJobs(*currentJob, count);
+        
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--pendingWorkers == 0) {
+                workDone.notify_one();
+            }
+        }
+    }
+}
+
+void ThreadPool::runJobs(const std::function<void(int)>& fn, int count) {
+    int index;
+    while ((index = nextIndex.fetch_add(1)) < count) {
+        fn(index);
+    }
+}
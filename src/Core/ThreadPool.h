@@ -0,0 +1,52 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <cstdint>
+
+// ============================================
+// THREAD POOL
+// ============================================
+// Fixed set of worker threads for data-parallel loops.
+// parallelFor hands out indices dynamically; the calling thread
+// participates and returns only when every index has run.
+class ThreadPool {
+private:
+    std::vector<std::thread> threads;
+    
+    std::mutex mutex;
+    std::condition_variable workReady;
+    std::condition_variable workDone;
+    
+    // Current job (guarded by mutex, indices handed out atomically)
+    const std::function<void(int)>* job;
+    int jobCount;
+    std::atomic<int> nextIndex;
+    int pendingWorkers;
+    uint64_t generation;
+    bool stopping;
+    
+    void workerLoop();
+    void runJobs(const std::function<void(int)>& fn, int count);
+    
+public:
+    // threadCount includes the calling thread (0 = hardware concurrency)
+    explicit ThreadPool(int threadCount = 0);
+    ~ThreadPool();
+    
+    // Delete copy constructor and assignment
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    
+    // Run fn(0..count-1) across the pool and wait for completion
+    void parallelFor(int count, const std::function<void(int)>& fn);
+    
+    int getThreadCount() const { return static_cast<int>(threads.size()) + 1; }
+};
+
+#endif // THREADPOOL_H
@@ -1,14 +1,15 @@
 #include "TimeManager.h"
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
 
 // Initialize static instance
 TimeManager* TimeManager::instance = nullptr;
 
 TimeManager::TimeManager() 
     : currentDay(1), currentHour(Config::DAY_START_HOUR), currentMinute(0),
-      secondsAccumulator(0.0f), isPaused(false), deltaTime(0.0f) {
-    clock.restart();
+      secondsAccumulator(0.0f), isPaused(false), deltaTime(0.0f),
+      warpFactor(1.0f), daysAdvanced(0) {
 }
 
 TimeManager* TimeManager::getInstance() {
@@ -25,36 +26,48 @@ void TimeManager::destroyInstance() {
     }
 }
 
-void TimeManager::update() {
+void TimeManager::update(float elapsedSeconds) {
     if (isPaused) {
         deltaTime = 0.0f;
-        clock.restart();  // Keep clock in sync
+        daysAdvanced = 0;
         return;
     }
     
-    // Calculate delta time
-    deltaTime = clock.restart().asSeconds();
+    // Delta time comes from the single authoritative clock (no second clock here)
+    deltaTime = elapsedSeconds;
     
     // Accumulate time
     secondsAccumulator += deltaTime;
+    daysAdvanced = 0;
     
-    // Check if a game minute has passed
-    while (secondsAccumulator >= Config::REAL_SECONDS_PER_GAME_MINUTE) {
-        secondsAccumulator -= Config::REAL_SECONDS_PER_GAME_MINUTE;
-        
-        // Advance time
-        currentMinute++;
-        
-        if (currentMinute >= Config::MINUTES_PER_HOUR) {
-            currentMinute = 0;
-            currentHour++;
-            
-            if (currentHour >= Config::HOURS_PER_DAY) {
-                currentHour = 0;
-                currentDay++;
-            }
-        }
+    if (secondsAccumulator < Config::REAL_SECONDS_PER_GAME_MINUTE) {
+        return;
     }
+    
+    // Advance whole game minutes in one step (large warped deltas stay O(1))
+    int minutesPassed = static_cast<int>(secondsAccumulator / Config::REAL_SECONDS_PER_GAME_MINUTE);
+    secondsAccumulator -= minutesPassed * Config::REAL_SECONDS_PER_GAME_MINUTE;
+    
+    int totalMinutes = currentHour * Config::MINUTES_PER_HOUR + currentMinute + minutesPassed;
+    int minutesPerDay = Config::HOURS_PER_DAY * Config::MINUTES_PER_HOUR;
+    
+    daysAdvanced = totalMinutes / minutesPerDay;
+    currentDay += daysAdvanced;
+    totalMinutes %= minutesPerDay;
+    
+    currentHour = totalMinutes / Config::MINUTES_PER_HOUR;
+    currentMinute = totalMinutes % Config::MINUTES_PER_HOUR;
+}
+
+double TimeManager::getGameMinutes() const {
+    int minutesPerDay = Config::HOURS_PER_DAY * Config::MINUTES_PER_HOUR;
+    double wholeMinutes = static_cast<double>(currentDay - 1) * minutesPerDay +
+                          currentHour * Config::MINUTES_PER_HOUR + currentMinute;
+    return wholeMinutes + secondsAccumulator / Config::REAL_SECONDS_PER_GAME_MINUTE;
+}
+
+void TimeManager::setWarpFactor(float factor) {
+    warpFactor = std::max(0.0f, std::min(Config::MAX_WARP_FACTOR, factor));
 }
 
 void TimeManager::pause() {
@@ -63,7 +76,6 @@ void TimeManager::pause() {
 
 void TimeManager::resume() {
     isPaused = false;
-    clock.restart();  // Reset clock to avoid time jump
 }
 
 void TimeManager::togglePause() {
@@ -116,5 +128,7 @@ void TimeManager::reset() {
     currentMinute = 0;
     secondsAccumulator = 0.0f;
     isPaused = false;
-    clock.restart();
+    deltaTime = 0.0f;
+    warpFactor = 1.0f;
+    daysAdvanced = 0;
 }
\ No newline at end of file
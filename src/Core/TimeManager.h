@@ -1,7 +1,7 @@
 #ifndef TIMEMANAGER_H
 #define TIMEMANAGER_H
 
-#include <SFML/System.hpp>
+#include <string>
 #include "Config.h"
 
 // Singleton Pattern: Manages game time
@@ -16,9 +16,12 @@ private:
     float secondsAccumulator;
     
     bool isPaused;
-    sf::Clock clock;
     float deltaTime;
     
+    // Time warp (fast-forward)
+    float warpFactor;     // Game seconds per real second (1.0 = normal speed)
+    int daysAdvanced;     // Day rollovers during the last update
+    
     // Private constructor for Singleton
     TimeManager();
     
@@ -31,18 +34,24 @@ public:
     TimeManager(const TimeManager&) = delete;
     TimeManager& operator=(const TimeManager&) = delete;
     
-    // Time updates
-    void update();
+    // Time updates (deltaTime supplied by the caller's authoritative clock)
+    void update(float elapsedSeconds);
     void pause();
     void resume();
     void togglePause();
     
+    // Time warp
+    void setWarpFactor(float factor);
+    float getWarpFactor() const { return warpFactor; }
+    
     // Getters
     int getCurrentDay() const { return currentDay; }
     int getCurrentHour() const { return currentHour; }
     int getCurrentMinute() const { return currentMinute; }
     float getDeltaTime() const { return deltaTime; }
     bool getIsPaused() const { return isPaused; }
+    int getDaysAdvanced() const { return daysAdvanced; }
+    double getGameMinutes() const;  // Game minutes since Day 1 00:00 (simulation timestamp)
     
     // Time queries
     bool isDay() const;
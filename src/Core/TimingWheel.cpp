@@ -0,0 +1,105 @@
+#include "TimingWheel.h"
+
+TimingWheel::TimingWheel() : currentTick(0) {
+    for (int level = 0; level < LEVELS; level++) {
+        levelCounts[level] = 0;
+    }
+}
+
+void TimingWheel::schedule(uint32_t id, uint64_t dueTick) {
+    // Anything already due fires on the next tick
+    if (dueTick <= currentTick) {
+        dueTick = currentTick + 1;
+    }
+    
+    // Clamp beyond the wheel's range (caller re-schedules when it fires)
+    if (dueTick - currentTick > getMaxDelay()) {
+        dueTick = currentTick + getMaxDelay();
+    }
+    
+    insert(Entry{id, dueTick});
+}
+
+void TimingWheel::insert(const Entry& entry) {
+    uint64_t delay = entry.dueTick - currentTick;
+    
+    // Pick the lowest level whose span covers the delay
+    int level = 0;
+    while (level < LEVELS - 1 && delay >= (uint64_t(1) << (SLOT_BITS * (level + 1)))) {
+        level++;
+    }
+    
+    int slot = static_cast<int>((entry.dueTick >> (SLOT_BITS * level)) & (SLOTS_PER_LEVEL - 1));
+    slots[level][slot].push_back(entry);
+    levelCounts[level]++;
+}
+
+void TimingWheel::cascade(int level) {
+    int slot = static_cast<int>((currentTick >> (SLOT_BITS * level)) & (SLOTS_PER_LEVEL - 1));
+    
+    std::vector<Entry> moving;
+    moving.swap(slots[level][slot]);
+    levelCounts[level] -= moving.size();
+    
+    // Re-insert relative to the new current tick (lands on a lower level)
+    for (const Entry& entry : moving) {
+        insert(entry);
+    }
+}
+
+void TimingWheel::advance(uint64_t targetTick, std::vector<Entry>& expired) {
+    while (currentTick < targetTick) {
+        // Nothing scheduled: jump straight to the target
+        if (size() == 0) {
+            currentTick = targetTick;
+            return;
+        }
+        
+        // Level 0 empty: skip to the tick before the next level-0 wrap
+        if (levelCounts[0] == 0) {
+            uint64_t beforeWrap = currentTick | (SLOTS_PER_LEVEL - 1);
+            if (beforeWrap > currentTick) {
+                currentTick = beforeWrap < targetTick ? beforeWrap : targetTick;
+                continue;
+            }
+        }
+        
+        currentTick++;
+        
+        // Cascade higher levels first when their slot boundary is reached
+        int wrapLevel = 0;
+        while (wrapLevel < LEVELS - 1 &&
+               ((currentTick >> (SLOT_BITS * (wrapLevel + 1))) << (SLOT_BITS * (wrapLevel + 1))) == currentTick) {
+            wrapLevel++;
+        }
+        for (int level = wrapLevel; level >= 1; level--) {
+            cascade(level);
+        }
+        
+        // Expire level-0 slot
+        std::vector<Entry>& due = slots[0][currentTick & (SLOTS_PER_LEVEL - 1)];
+        if (!due.empty()) {
+            levelCounts[0] -= due.size();
+            expired.insert(expired.end(), due.begin(), due.end());
+            due.clear();
+        }
+    }
+}
+
+void TimingWheel::clear() {
+    for (int level = 0; level < LEVELS; level++) {
+        for (int slot = 0; slot < SLOTS_PER_LEVEL; slot++) {
+            slots[level][slot].clear();
+        }
+        levelCounts[level] = 0;
+    }
+    currentTick = 0;
+}
+
+size_t TimingWheel::size() const {
+    size_t total = 0;
+    for (int level = 0; level < LEVELS; level++) {
+        total += levelCounts[level];
+    }
+    return total;
+}
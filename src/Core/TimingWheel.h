@@ -0,0 +1,56 @@
+#ifndef TIMINGWHEEL_H
+#define TIMINGWHEEL_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// ============================================
+// HIERARCHICAL TIMING WHEEL
+// ============================================
+// Schedules integer ids to wake at an absolute tick. Each level has
+// SLOTS_PER_LEVEL slots; level k slots are SLOTS_PER_LEVEL^k ticks wide.
+// Entries cascade down a level as their slot comes due, so schedule and
+// expiry are O(1) amortised and cost scales with events, not with ids.
+//
+// Cancellation is lazy: callers keep their own "current due tick" per id
+// and ignore expired entries whose due tick no longer matches.
+class TimingWheel {
+public:
+    struct Entry {
+        uint32_t id;
+        uint64_t dueTick;
+    };
+    
+    static const int LEVELS = 4;
+    static const int SLOT_BITS = 8;
+    static const int SLOTS_PER_LEVEL = 1 << SLOT_BITS;
+    
+private:
+    std::vector<Entry> slots[LEVELS][SLOTS_PER_LEVEL];
+    size_t levelCounts[LEVELS];
+    uint64_t currentTick;
+    
+    void insert(const Entry& entry);
+    void cascade(int level);
+    
+public:
+    TimingWheel();
+    
+    // Schedule id to expire at dueTick (past or current ticks expire on the next advance)
+    void schedule(uint32_t id, uint64_t dueTick);
+    
+    // Advance to targetTick, appending every entry that came due
+    void advance(uint64_t targetTick, std::vector<Entry>& expired);
+    
+    // Drop all entries and restart at tick 0
+    void clear();
+    
+    uint64_t getCurrentTick() const { return currentTick; }
+    size_t size() const;
+    
+    // Largest delay representable without clamping
+    static uint64_t getMaxDelay() { return (uint64_t(1) << (SLOT_BITS * LEVELS)) - 1; }
+};
+
+#endif // TIMINGWHEEL_H
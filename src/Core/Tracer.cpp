@@ -0,0 +1,132 @@
+#include "Tracer.h"
+#include <fstream>
+#include <iomanip>
+
+namespace {
+
+// Small per-thread ids for the "tid" field (0 = not yet assigned)
+thread_local uint32_t traceThreadId = 0;
+
+} // namespace
+
+// ============================================
+// Singleton
+// ============================================
+Tracer* Tracer::instance = nullptr;
+
+Tracer* Tracer::getInstance() {
+    if (instance == nullptr) {
+        instance = new Tracer();
+    }
+    return instance;
+}
+
+void Tracer::destroyInstance() {
+    if (instance != nullptr) {
+        delete instance;
+        instance = nullptr;
+    }
+}
+
+Tracer::Tracer()
+    : eventCount(0), droppedCount(0), nextAsyncId(1), nextThreadId(1),
+      origin(TraceClock::now()), enabled(false) {
+}
+
+// ============================================
+// Recording
+// ============================================
+void Tracer::start(size_t maxEvents) {
+    enabled = false;
+    events.assign(maxEvents, Event());  // All allocation happens here
+    eventCount.store(0);
+    droppedCount.store(0);
+    origin = TraceClock::now();
+    enabled = maxEvents > 0;
+}
+
+void Tracer::record(TracePhase phase, const char* name, const char* category,
+                    double timestampUs, double durationUs, uint64_t id) {
+    size_t slot = eventCount.fetch_add(1, std::memory_order_relaxed);
+    if (slot >= events.size()) {
+        droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    if (traceThreadId == 0) {
+        traceThreadId = nextThreadId.fetch_add(1);
+    }
+
+    Event& event = events[slot];
+    event.name = name;
+    event.category = category;
+    event.timestampUs = timestampUs;
+    event.durationUs = durationUs;
+    event.id = id;
+    event.threadId = traceThreadId;
+    event.phase = phase;
+}
+
+void Tracer::complete(const char* name, const char* category,
+                      TraceClock::time_point begin, TraceClock::time_point end) {
+    if (!enabled) {
+        return;
+    }
+    record(TracePhase::COMPLETE, name, category, toMicros(begin),
+           std::chrono::duration<double, std::micro>(end - begin).count(), 0);
+}
+
+uint64_t Tracer::newAsyncId() {
+    return enabled ? nextAsyncId.fetch_add(1, std::memory_order_relaxed) : 0;
+}
+
+void Tracer::async(TracePhase phase, const char* name, const char* category, uint64_t id) {
+    if (!enabled || id == 0) {
+        return;
+    }
+    record(phase, name, category, toMicros(TraceClock::now()), 0.0, id);
+}
+
+size_t Tracer::getEventCount() const {
+    size_t count = eventCount.load();
+    return count < events.size() ? count : events.size();
+}
+
+// ============================================
+// Export
+// ============================================
+void Tracer::writeJson(std::ostream& out) const {
+    std::ios::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+    out << std::fixed << std::setprecision(3);
+
+    out << "{\"traceEvents\":[\n";
+    out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Templanter\"}}";
+
+    size_t count = getEventCount();
+    for (size_t i = 0; i < count; i++) {
+        const Event& event = events[i];
+        out << ",\n{\"name\":\"" << event.name << "\",\"cat\":\"" << event.category
+            << "\",\"ph\":\"" << static_cast<char>(event.phase) << "\",\"ts\":" << event.timestampUs
+            << ",\"pid\":1,\"tid\":" << event.threadId;
+        if (event.phase == TracePhase::COMPLETE) {
+            out << ",\"dur\":" << event.durationUs;
+        } else {
+            out << ",\"id\":" << event.id;
+        }
+        out << "}";
+    }
+
+    out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    out.flags(flags);
+    out.precision(precision);
+}
+
+bool Tracer::save(const std::string& path) const {
+    std::ofstream file(path.c_str());
+    if (!file) {
+        return false;
+    }
+    writeJson(file);
+    return static_cast<bool>(file);
+}
@@ -0,0 +1,120 @@
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Chrome trace_event phases used by the tracer
+enum class TracePhase : char {
+    COMPLETE = 'X',      // Duration event (tick phases, notifications)
+    ASYNC_BEGIN = 'b',   // Nestable async span (task lifecycles)
+    ASYNC_END = 'e',
+    ASYNC_INSTANT = 'n'
+};
+
+// ============================================
+// TRACER (Singleton)
+// ============================================
+// Optional recorder for Chrome trace_event JSON (chrome://tracing,
+// ui.perfetto.dev). start() preallocates the event buffer; recording
+// only claims a slot with one atomic increment and stores a few words,
+// so tracing does not allocate on the hot path. Names and categories
+// must be string literals (only the pointer is kept). When the buffer
+// is full further events are counted and dropped.
+class Tracer {
+public:
+    typedef std::chrono::steady_clock TraceClock;
+
+private:
+    struct Event {
+        const char* name;
+        const char* category;
+        double timestampUs;  // Since start()
+        double durationUs;   // COMPLETE only
+        uint64_t id;         // Async span id
+        uint32_t threadId;
+        TracePhase phase;
+    };
+
+    static Tracer* instance;
+
+    std::vector<Event> events;
+    std::atomic<size_t> eventCount;
+    std::atomic<uint64_t> droppedCount;
+    std::atomic<uint64_t> nextAsyncId;
+    std::atomic<uint32_t> nextThreadId;
+    TraceClock::time_point origin;
+    bool enabled;
+
+    Tracer();
+
+    double toMicros(TraceClock::time_point time) const {
+        return std::chrono::duration<double, std::micro>(time - origin).count();
+    }
+    void record(TracePhase phase, const char* name, const char* category,
+                double timestampUs, double durationUs, uint64_t id);
+
+public:
+    static Tracer* getInstance();
+    static void destroyInstance();
+
+    // Delete copy constructor and assignment
+    Tracer(const Tracer&) = delete;
+    Tracer& operator=(const Tracer&) = delete;
+
+    // Begin recording into a fresh buffer of maxEvents (discards earlier events)
+    void start(size_t maxEvents);
+    void stop() { enabled = false; }
+    bool isEnabled() const { return enabled; }
+
+    // Duration event for [begin, end)
+    void complete(const char* name, const char* category,
+                  TraceClock::time_point begin, TraceClock::time_point end);
+
+    // Async spans: newAsyncId() returns 0 while tracing is off, and
+    // events with id 0 are ignored, so untraced objects cost nothing
+    uint64_t newAsyncId();
+    void async(TracePhase phase, const char* name, const char* category, uint64_t id);
+
+    size_t getEventCount() const;
+    uint64_t getDroppedCount() const { return droppedCount.load(); }
+
+    // {"traceEvents": [...]} for the events recorded so far
+    void writeJson(std::ostream& out) const;
+    bool save(const std::string& path) const;
+
+    // ============================================
+    // SCOPED DURATION EVENT
+    // ============================================
+    // Tracer::Scope scope("notify", "plant");
+    class Scope {
+    private:
+        const char* name;
+        const char* category;
+        TraceClock::time_point begin;
+        bool active;
+
+    public:
+        Scope(const char* n, const char* c)
+            : name(n), category(c), active(Tracer::getInstance()->isEnabled()) {
+            if (active) {
+                begin = TraceClock::now();
+            }
+        }
+
+        ~Scope() {
+            if (active) {
+                Tracer::getInstance()->complete(name, category, begin, TraceClock::now());
+            }
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+};
+
+#endif // TRACER_H
@@ -1,5 +1,5 @@
 #include "Customer.h"
-#include <iostream>
+#include "Core/Logger.h"
 
 Customer::Customer(int customerId, const std::string& customerName, CustomerType custType, float maxWait)
     : id(customerId), name(customerName), type(custType), 
@@ -13,7 +13,7 @@ void Customer::update(float deltaTime) {
         
         if (waitTimer <= 0.0f && !leftAngry) {
             leftAngry = true;
-            std::cout << "⏰ Customer " << name << " timed out and left angry!" << std::endl;
+            LOG_WARN(CUSTOMER, "⏰ Customer " << name << " timed out and left angry!");
         }
     }
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define CUSTOMER_H
 
 #include <string>
+#include "Core/LiveCount.h"
 
 // Forward declarations
 class CustomerVisitor;
@@ -15,7 +16,7 @@ enum class CustomerType {
 };
 
 // Base Customer class (will be created by Factory)
-class Customer {
+class Customer : public LiveCount<Customer> {
 protected:
     int id;
     std::string name;
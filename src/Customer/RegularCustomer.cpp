@@ -11,6 +11,11 @@ RegularCustomer::RegularCustomer(int id, const std::string& name)
     requestedPlant = db->getRandomPlantByDemand();
 }
 
+RegularCustomer::RegularCustomer(int id, const std::string& name, PlantType requested)
+    : Customer(id, name, CustomerType::REGULAR, Config::CUSTOMER_REGULAR_WAIT_TIME),
+      requestedPlant(requested) {
+}
+
 void RegularCustomer::accept(CustomerVisitor* visitor) {
     visitor->visitRegularCustomer(this);
 }
@@ -10,7 +10,8 @@ private:
     PlantType requestedPlant;
     
 public:
-    RegularCustomer(int id, const std::string& name);
+    RegularCustomer(int id, const std::string& name);                            // Picks by demand
+    RegularCustomer(int id, const std::string& name, PlantType requested);      // Pre-drawn pick
     
     void accept(CustomerVisitor* visitor) override;
     Plant* selectPlant() override;
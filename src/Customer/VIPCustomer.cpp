@@ -2,7 +2,7 @@
 #include "Patterns/Visitor/CustomerVisitor.h"
 #include "Greenhouse/PlantTypes.h"
 #include "Core/Config.h"
-#include <random>
+#include "Core/Random.h"
 
 VIPCustomer::VIPCustomer(int id, const std::string& name)
     : Customer(id, name, CustomerType::VIP, Config::CUSTOMER_VIP_WAIT_TIME) {
@@ -12,10 +12,8 @@ VIPCustomer::VIPCustomer(int id, const std::string& name)
     auto advancedPlants = db->getPlantsByTier(PlantTier::ADVANCED);
     
     if (!advancedPlants.empty()) {
-        std::random_device rd;
-        std::mt19937 gen(rd());
-        std::uniform_int_distribution<> dist(0, advancedPlants.size() - 1);
-        requestedPlant = advancedPlants[dist(gen)];
+        RandomStream& random = RandomService::stream(RandomStreamId::CUSTOMERS);
+        requestedPlant = advancedPlants[random.nextInt(0, static_cast<int>(advancedPlants.size()) - 1)];
     } else {
         // Fallback to random
         requestedPlant = db->getRandomPlantByDemand();
@@ -1,45 +1,8 @@
 #include "Plant.h"
 #include "Patterns/Observer/Observer.h"
-#include <iostream>
+#include "Core/Logger.h"
 #include <algorithm>
 
-// ============================================
-// CONSTRUCTOR
-// ============================================
-Plant::Plant(int plantId, PlantType type, int x, int y)
-    : id(plantId), posX(x), posY(y), plantType(type),
-      currentState(nullptr), growthCycle(nullptr),
-      growthProgress(0.0f), waterLevel(100), decayTimer(0.0f),
-      growthModifier(1.0f), pendingGrowth(0.0f),
-      subject(nullptr),
-      needsWaterNotified(false), ripeNotified(false), 
-      decayingNotified(false), deadNotified(false) {
-    
-    // Initialize with Seed state (State Pattern)
-    currentState = new SeedState();
-    
-    // Initialize with normal growth cycle (Template Method Pattern)
-    growthCycle = new NormalGrowthCycle();
-    
-    // Create subject (Observer Pattern - this plant is observable)
-    subject = new PlantSubject(this);
-    
-    // Set initial watering time
-    lastWateredTime = std::time(nullptr);
-    
-    std::cout << "🌱 Plant created: " << getPlantTypeInfo().name 
-              << " at (" << posX << ", " << posY << ")" << std::endl;
-}
-
-// ============================================
-// DESTRUCTOR
-// ============================================
-Plant::~Plant() {
-    delete currentState;
-    delete growthCycle;
-    delete subject;
-}
-
 // ============================================
 // MAIN UPDATE LOOP
 // ============================================
@@ -47,39 +10,46 @@ void Plant::update(float deltaTime) {
     // ============================================
     // TEMPLATE METHOD PATTERN: Execute growth cycle
     // ============================================
-    growthCycle->executeGrowthCycle(this, deltaTime);
+    GrowthCycle::get(static_cast<GrowthCycleId>(store->cycleId[slot]))->executeGrowthCycle(this, deltaTime);
     
     // ============================================
     // STATE PATTERN: Update current state
     // ============================================
-    currentState->update(this, deltaTime);
+    getState()->update(this, deltaTime);
     
     // ============================================
     // OBSERVER PATTERN: Check for events and notify observers
     // ============================================
+    notifyEvents();
+}
+
+void Plant::notifyEvents() {
+    uint8_t& flags = store->flags[slot];
     
     // Event 1: Plant needs water
-    if (needsWater() && !needsWaterNotified) {
-        subject->notifyNeedsWater();
-        needsWaterNotified = true;
+    if (needsWater() && !(flags & PlantStore::FLAG_NEEDS_WATER_NOTIFIED)) {
+        notifyEvent(PlantEventType::NEEDS_WATER);
+        flags |= PlantStore::FLAG_NEEDS_WATER_NOTIFIED;
     }
     
+    PlantStateId state = getStateId();
+    
     // Event 2: Plant is ripe and ready to harvest
-    if (currentState->canHarvest() && !ripeNotified && getStateName() == "Ripe") {
-        subject->notifyRipe();
-        ripeNotified = true;
+    if (state == PlantStateId::RIPE && !(flags & PlantStore::FLAG_RIPE_NOTIFIED)) {
+        notifyEvent(PlantEventType::RIPE);
+        flags |= PlantStore::FLAG_RIPE_NOTIFIED;
     }
     
     // Event 3: Plant is decaying
-    if (getStateName() == "Decaying" && !decayingNotified) {
-        subject->notifyDecaying();
-        decayingNotified = true;
+    if (state == PlantStateId::DECAYING && !(flags & PlantStore::FLAG_DECAYING_NOTIFIED)) {
+        notifyEvent(PlantEventType::DECAYING);
+        flags |= PlantStore::FLAG_DECAYING_NOTIFIED;
     }
     
     // Event 4: Plant died
-    if (getStateName() == "Dead" && !deadNotified) {
-        subject->notifyDead();
-        deadNotified = true;
+    if (state == PlantStateId::DEAD && !(flags & PlantStore::FLAG_DEAD_NOTIFIED)) {
+        notifyEvent(PlantEventType::DEAD);
+        flags |= PlantStore::FLAG_DEAD_NOTIFIED;
     }
 }
 
@@ -89,18 +59,18 @@ void Plant::update(float deltaTime) {
 
 void Plant::water() {
     // Delegate to current state (State Pattern)
-    currentState->water(this);
+    getState()->water(this);
     
     // Reset notification flag
-    needsWaterNotified = false;
+    store->flags[slot] &= ~PlantStore::FLAG_NEEDS_WATER_NOTIFIED;
     
-    std::cout << "💧 Watered " << getPlantTypeInfo().name 
-              << " at (" << posX << ", " << posY << ")" << std::endl;
+    LOG_INFO(PLANT, "💧 Watered " << getPlantTypeInfo().name 
+                    << " at (" << getPosX() << ", " << getPosY() << ")");
 }
 
 bool Plant::harvest(int& value) {
-    if (!currentState->canHarvest()) {
-        std::cout << "❌ Cannot harvest - plant not ready" << std::endl;
+    if (!canHarvest()) {
+        LOG_WARN(PLANT, "❌ Cannot harvest - plant not ready");
         return false;
     }
     
@@ -109,55 +79,54 @@ bool Plant::harvest(int& value) {
     value = info.sellPrice;
     
     // Reduce value if decaying
-    if (getStateName() == "Decaying") {
+    if (getStateId() == PlantStateId::DECAYING) {
         value = static_cast<int>(value * 0.5f);
-        std::cout << "⚠️  Plant was decaying - value reduced to $" << value << std::endl;
+        LOG_INFO(PLANT, "⚠️  Plant was decaying - value reduced to $" << value);
     }
     
-    std::cout << "🌾 Harvested " << info.name << " for $" << value << std::endl;
+    LOG_INFO(PLANT, "🌾 Harvested " << info.name << " for $" << value);
     return true;
 }
 
 void Plant::applyNutrient() {
     // Switch to boosted growth cycle (Strategy Pattern element)
-    delete growthCycle;
-    growthCycle = new BoostedGrowthCycle(1.5f);  // 50% faster growth
+    store->cycleId[slot] = static_cast<uint8_t>(GrowthCycleId::BOOSTED);  // 50% faster growth
     
-    std::cout << "✨ Applied nutrient to " << getPlantTypeInfo().name 
-              << " - Growth boosted by 50%!" << std::endl;
+    LOG_INFO(PLANT, "✨ Applied nutrient to " << getPlantTypeInfo().name 
+                    << " - Growth boosted by 50%!");
 }
 
 // ============================================
 // STATE PATTERN: State management
 // ============================================
 
-void Plant::setState(PlantState* newState) {
-    if (currentState != nullptr) {
-        std::string oldState = currentState->getStateName();
-        delete currentState;
-        currentState = newState;
+void Plant::setState(PlantStateId newState) {
+    uint8_t& state = store->stateId[slot];
+    
+    // Shared state objects: nothing to allocate or free
+    if (store->isOccupied(slot)) {
+        PlantStateId oldState = getStateId();
+        state = static_cast<uint8_t>(newState);
         
-        std::cout << "🔄 Plant state changed: " << oldState 
-                  << " → " << newState->getStateName() << std::endl;
+        LOG_DEBUG(PLANT, "🔄 Plant state changed: " << PlantState::getName(oldState) 
+                         << " → " << PlantState::getName(newState));
     } else {
-        currentState = newState;
+        state = static_cast<uint8_t>(newState);
     }
     
     // Reset notification flags on state change
-    if (newState->getStateName() == "Ripe") {
-        ripeNotified = false;
-    } else if (newState->getStateName() == "Decaying") {
-        decayingNotified = false;
-    } else if (newState->getStateName() == "Dead") {
-        deadNotified = false;
+    uint8_t& flags = store->flags[slot];
+    if (newState == PlantStateId::RIPE) {
+        flags &= ~PlantStore::FLAG_RIPE_NOTIFIED;
+    } else if (newState == PlantStateId::DECAYING) {
+        flags &= ~PlantStore::FLAG_DECAYING_NOTIFIED;
+    } else if (newState == PlantStateId::DEAD) {
+        flags &= ~PlantStore::FLAG_DEAD_NOTIFIED;
     }
 }
 
 std::string Plant::getStateName() const {
-    if (currentState == nullptr) {
-        return "UNKNOWN";
-    }
-    return currentState->getStateName();
+    return PlantState::getName(getStateId());
 }
 
 // ============================================
@@ -166,12 +135,12 @@ std::string Plant::getStateName() const {
 
 void Plant::attach(Observer* observer) {
     if (observer == nullptr) {
-        std::cerr << "Plant::attach - null observer" << std::endl;
+        LOG_ERROR(PLANT, "Plant::attach - null observer");
         return;
     }
     
-    subject->attach(observer);
-    std::cout << "👁️  Observer attached to plant at (" << posX << ", " << posY << ")" << std::endl;
+    getSubject()->attach(observer);
+    LOG_DEBUG(PLANT, "👁️  Observer attached to plant at (" << getPosX() << ", " << getPosY() << ")");
 }
 
 void Plant::detach(Observer* observer) {
@@ -179,30 +148,42 @@ void Plant::detach(Observer* observer) {
         return;
     }
     
-    subject->detach(observer);
-    std::cout << "👁️  Observer detached from plant at (" << posX << ", " << posY << ")" << std::endl;
+    getSubject()->detach(observer);
+    LOG_DEBUG(PLANT, "👁️  Observer detached from plant at (" << getPosX() << ", " << getPosY() << ")");
+}
+
+PlantSubject* Plant::getSubject() const {
+    PlantSubject*& subject = store->subjects[slot];
+    if (subject == nullptr) {
+        subject = new PlantSubject(const_cast<Plant*>(this));
+    }
+    return subject;
+}
+
+void Plant::dispatchEvent(PlantEventType type) {
+    store->dispatchEvent(slot, type);
+}
+
+void Plant::notifyEvent(PlantEventType type) {
+    // Parallel updates queue events for ordered delivery on the main thread
+    PlantEventBuffer* buffer = PlantEventBuffer::getThreadBuffer();
+    if (buffer != nullptr) {
+        buffer->push(this, type);
+        return;
+    }
+    dispatchEvent(type);
 }
 
 // ============================================
 // GETTERS
 // ============================================
 
-const PlantTypeInfo& Plant::getPlantTypeInfo() const {
-    return PlantTypeDatabase::getInstance()->getPlantInfo(plantType);
-}
-
 bool Plant::canHarvest() const {
-    if (currentState == nullptr) {
-        return false;
-    }
-    return currentState->canHarvest();
+    return getState()->canHarvest();
 }
 
 int Plant::getSpriteIndex() const {
-    if (currentState == nullptr) {
-        return 0;
-    }
-    return currentState->getSpriteIndex();
+    return getState()->getSpriteIndex();
 }
 
 // ============================================
@@ -210,42 +191,51 @@ int Plant::getSpriteIndex() const {
 // ============================================
 
 void Plant::setGrowthProgress(float progress) {
-    growthProgress = std::max(0.0f, std::min(100.0f, progress));
+    store->growthProgress[slot] = std::max(0.0f, std::min(100.0f, progress));
 }
 
 void Plant::addGrowthProgress(float progress) {
+    float& growthProgress = store->growthProgress[slot];
     float oldProgress = growthProgress;
     growthProgress += progress;
     growthProgress = std::max(0.0f, std::min(100.0f, growthProgress));
     
+    logGrowthMilestone(oldProgress, growthProgress);
+}
+
+void Plant::logGrowthMilestone(float oldProgress, float growthProgress) const {
+    int posX = getPosX();
+    int posY = getPosY();
+    
     // Log significant growth milestones
     if (oldProgress < 25.0f && growthProgress >= 25.0f) {
-        std::cout << "📈 Plant at (" << posX << ", " << posY << ") reached 25% growth" << std::endl;
+        LOG_DEBUG(PLANT, "📈 Plant at (" << posX << ", " << posY << ") reached 25% growth");
     } else if (oldProgress < 50.0f && growthProgress >= 50.0f) {
-        std::cout << "📈 Plant at (" << posX << ", " << posY << ") reached 50% growth" << std::endl;
+        LOG_DEBUG(PLANT, "📈 Plant at (" << posX << ", " << posY << ") reached 50% growth");
     } else if (oldProgress < 75.0f && growthProgress >= 75.0f) {
-        std::cout << "📈 Plant at (" << posX << ", " << posY << ") reached 75% growth" << std::endl;
+        LOG_DEBUG(PLANT, "📈 Plant at (" << posX << ", " << posY << ") reached 75% growth");
     } else if (oldProgress < 100.0f && growthProgress >= 100.0f) {
-        std::cout << "🎉 Plant at (" << posX << ", " << posY << ") reached 100% growth!" << std::endl;
+        LOG_DEBUG(PLANT, "🎉 Plant at (" << posX << ", " << posY << ") reached 100% growth!");
     }
 }
 
 void Plant::setWaterLevel(int level) {
+    int& waterLevel = store->waterLevel[slot];
     int oldLevel = waterLevel;
     waterLevel = std::max(0, std::min(100, level));
     
     // Log if water level changed significantly
     if (oldLevel >= 30 && waterLevel < 30) {
-        std::cout << "⚠️  Plant at (" << posX << ", " << posY << ") water level critical!" << std::endl;
+        LOG_DEBUG(PLANT, "⚠️  Plant at (" << getPosX() << ", " << getPosY() << ") water level critical!");
     }
 }
 
-void Plant::setLastWateredTime(std::time_t time) {
-    lastWateredTime = time;
+void Plant::setLastWateredTime(double gameMinutes) {
+    store->lastWateredTime[slot] = gameMinutes;
 }
 
 void Plant::addDecayTimer(float minutes) {
-    decayTimer += minutes;
+    store->decayTimer[slot] += minutes;
 }
 
 // ============================================
@@ -255,79 +245,111 @@ void Plant::addDecayTimer(float minutes) {
 void Plant::updateWaterLevel(float deltaTime) {
     const PlantTypeInfo& info = getPlantTypeInfo();
     
-    // Calculate time since last watered (in hours)
-    std::time_t now = std::time(nullptr);
-    double hoursSinceWatered = std::difftime(now, lastWateredTime) / 3600.0;
+    float& waterDeficit = store->waterDeficit[slot];
+    int& waterLevel = store->waterLevel[slot];
     
-    // Calculate water depletion rate
     // Water depletes over the waterIntervalHours period
-    float depletionRate = 100.0f / static_cast<float>(info.waterIntervalHours);
-    float depletion = depletionRate * (deltaTime / 60.0f);  // deltaTime is in minutes
+    // Accumulate fractional depletion so the result doesn't depend on step size
+    waterDeficit += info.depletionPerHour * (deltaTime / 60.0f);  // deltaTime is in minutes
+    int depletion = static_cast<int>(waterDeficit);
+    waterDeficit -= depletion;
     
-    waterLevel -= static_cast<int>(depletion);
+    waterLevel -= depletion;
     waterLevel = std::max(0, waterLevel);
 }
 
-bool Plant::needsWater() const {
+// ============================================
+// EVENT PREDICTION: For the plant event scheduler
+// ============================================
+
+float Plant::getCycleGrowthRate() const {
+    GrowthCycle* growthCycle = GrowthCycle::get(static_cast<GrowthCycleId>(store->cycleId[slot]));
+    return getPlantTypeInfo().growthPerMinute * growthCycle->getGrowthModifierFor(getWaterLevel());
+}
+
+float Plant::getTimeUntilNextEvent() const {
+    PlantState* currentState = getState();
+    float next = currentState->getTimeUntilTransition(this);
     const PlantTypeInfo& info = getPlantTypeInfo();
     
-    // Check if water level is critically low
-    if (waterLevel < 30) {
-        return true;
+    // Watering interval running out also raises NEEDS_WATER
+    if (!(store->flags[slot] & PlantStore::FLAG_NEEDS_WATER_NOTIFIED)) {
+        double intervalEnd = getLastWateredTime() + info.waterIntervalMinutes;
+        next = std::min(next, static_cast<float>(intervalEnd - getCurrentMinutes()));
     }
     
-    // Check if watering interval has passed
-    std::time_t now = std::time(nullptr);
-    double hoursSinceWatered = std::difftime(now, lastWateredTime) / 3600.0;
+    if (currentState->consumesWater()) {
+        // Water levels whose crossing changes behaviour:
+        // <30 needs water, <=20 slower state growth, <20 growth modifier, 0 dry
+        static const int WATER_THRESHOLDS[] = {29, 20, 19, 0};
+        
+        float depletionPerMinute = info.depletionPerHour / 60.0f;
+        int waterLevel = getWaterLevel();
+        float waterDeficit = store->waterDeficit[slot];
+        
+        for (int threshold : WATER_THRESHOLDS) {
+            if (waterLevel > threshold) {
+                float drop = static_cast<float>(waterLevel - threshold) - waterDeficit;
+                next = std::min(next, drop / depletionPerMinute);
+            }
+        }
+    }
     
-    return hoursSinceWatered >= info.waterIntervalHours;
+    return std::max(0.0f, next);
 }
 
 // ============================================
 // SERIALIZATION: For save/load via Memento
 // ============================================
 
-PlantData Plant::serialize() const {
+PlantRecord Plant::capture() const {
+    PlantRecord record;
+    record.id = getId();
+    record.posX = store->posX[slot];
+    record.posY = store->posY[slot];
+    record.plantType = store->plantType[slot];
+    record.stateId = store->stateId[slot];
+    record.growthProgress = getGrowthProgress();
+    record.waterLevel = getWaterLevel();
+    record.lastWateredTime = getLastWateredTime();
+    
+    return record;
+}
+
+PlantData Plant::serialize(const PlantRecord& record) {
     PlantData data;
-    data.id = id;
-    data.type = PlantTypeDatabase::getInstance()->getPlantName(plantType);
-    data.posX = posX;
-    data.posY = posY;
-    data.state = getStateName();
-    data.growthProgress = growthProgress;
-    data.waterLevel = waterLevel;
-    data.lastWateredTime = lastWateredTime;
+    data.id = record.id;
+    data.type = PlantTypeDatabase::getInstance()->getPlantName(static_cast<PlantType>(record.plantType));
+    data.posX = record.posX;
+    data.posY = record.posY;
+    data.state = PlantState::getName(static_cast<PlantStateId>(record.stateId));
+    data.growthProgress = record.growthProgress;
+    data.waterLevel = record.waterLevel;
+    data.lastWateredTime = record.lastWateredTime;
     
     return data;
 }
 
-Plant* Plant::deserialize(const PlantData& data) {
+Plant* Plant::deserialize(const PlantData& data, PlantStore& store, int slot) {
     // Get plant type from name (Flyweight Pattern)
     PlantType type = PlantTypeDatabase::getInstance()->getPlantTypeByName(data.type);
     
     // Create plant
-    Plant* plant = new Plant(data.id, type, data.posX, data.posY);
+    Plant* plant = store.create(slot, data.id, type, data.posX, data.posY);
     
     // Restore growth state
-    plant->growthProgress = data.growthProgress;
-    plant->waterLevel = data.waterLevel;
-    plant->lastWateredTime = data.lastWateredTime;
+    store.growthProgress[slot] = data.growthProgress;
+    store.waterLevel[slot] = data.waterLevel;
+    store.lastWateredTime[slot] = data.lastWateredTime;
     
     // Set appropriate state based on saved state name (State Pattern)
-    if (data.state == "Seed") {
-        plant->setState(new SeedState());
-    } else if (data.state == "Growing") {
-        plant->setState(new GrowingState());
-    } else if (data.state == "Ripe") {
-        plant->setState(new RipeState());
-    } else if (data.state == "Decaying") {
-        plant->setState(new DecayingState());
-    } else if (data.state == "Dead") {
-        plant->setState(new DeadState());
+    PlantStateId state;
+    if (PlantState::getIdByName(data.state, state)) {
+        plant->setState(state);
     }
     
-    std::cout << "📦 Deserialized plant: " << data.type 
-              << " (" << data.state << ") at (" << data.posX << ", " << data.posY << ")" << std::endl;
+    LOG_DEBUG(PLANT, "📦 Deserialized plant: " << data.type 
+                     << " (" << data.state << ") at (" << data.posX << ", " << data.posY << ")");
     
     return plant;
-}
\ No newline at end of file
+}
@@ -2,17 +2,18 @@
 #define PLANT_H
 
 #include <string>
-#include <ctime>
 #include "Core/GameData.h"
 #include "PlantTypes.h"
 #include "Patterns/State/PlantState.h"
 #include "Patterns/Observer/PlantSubject.h"
 #include "Patterns/Template/GrowthCycle.h"
+#include "PlantStore.h"
 
 // Forward declarations
 class PlantState;
 class GrowthCycle;
 class Observer;
+class PlantStore;
 
 // ============================================
 // PLANT CLASS
@@ -21,64 +22,32 @@ class Observer;
 // - State Pattern: Plant growth states
 // - Observer Pattern: Plant is an observable subject
 // - Template Method: Growth cycle algorithm
-// - Flyweight: Shares PlantTypeInfo data
+// - Flyweight: Shares PlantTypeInfo data, states and growth cycles
+//
+// A Plant is a handle to one slot of a PlantStore, which holds the
+// actual data in parallel arrays. Handles are created by the store and
+// keep a stable address for the store's lifetime.
 class Plant {
-private:
-    // ============================================
-    // UNIQUE PLANT DATA (Not shared)
-    // ============================================
-    int id;
-    int posX, posY;
-    
-    // ============================================
-    // FLYWEIGHT PATTERN: Reference to shared data
-    // ============================================
-    PlantType plantType;
-    
-    // ============================================
-    // STATE PATTERN: Current state
-    // ============================================
-    PlantState* currentState;
-    
-    // ============================================
-    // TEMPLATE METHOD PATTERN: Growth algorithm
-    // ============================================
-    GrowthCycle* growthCycle;
+    friend class PlantStore;
     
-    // ============================================
-    // GROWTH TRACKING
-    // ============================================
-    float growthProgress;      // 0-100%
-    int waterLevel;            // 0-100%
-    std::time_t lastWateredTime;
-    float decayTimer;          // Minutes in current state
+private:
+    PlantStore* store;
+    int slot;
     
-    // Growth modifiers
-    float growthModifier;
-    float pendingGrowth;
+    Plant() : store(nullptr), slot(-1) {}
     
-    // ============================================
-    // OBSERVER PATTERN: This plant is a subject
-    // ============================================
-    PlantSubject* subject;
-    
-    // Notification flags (prevent spam)
-    bool needsWaterNotified;
-    bool ripeNotified;
-    bool decayingNotified;
-    bool deadNotified;
+    void notifyEvent(PlantEventType type);
+    void notifyEvents();  // Raise any newly reached events
+    void logGrowthMilestone(float oldProgress, float newProgress) const;
 
 public:
-    // ============================================
-    // CONSTRUCTOR & DESTRUCTOR
-    // ============================================
-    Plant(int plantId, PlantType type, int x, int y);
-    ~Plant();
-    
     // Delete copy constructor and assignment (prevent accidental copying)
     Plant(const Plant&) = delete;
     Plant& operator=(const Plant&) = delete;
     
+    int getSlot() const { return slot; }
+    bool isPlanted() const;  // False once harvested (the handle outlives the plant)
+    
     // ============================================
     // MAIN UPDATE LOOP
     // ============================================
@@ -94,8 +63,9 @@ public:
     // ============================================
     // STATE PATTERN: State management
     // ============================================
-    void setState(PlantState* newState);
-    PlantState* getState() const { return currentState; }
+    void setState(PlantStateId newState);
+    PlantState* getState() const;
+    PlantStateId getStateId() const;
     std::string getStateName() const;
     
     // ============================================
@@ -103,26 +73,28 @@ public:
     // ============================================
     void attach(Observer* observer);
     void detach(Observer* observer);
-    PlantSubject* getSubject() const { return subject; }
+    PlantSubject* getSubject() const;              // Per-plant subject (created on demand)
+    void dispatchEvent(PlantEventType type);       // Notify observers now
     
     // ============================================
     // GETTERS: Basic info
     // ============================================
-    int getId() const { return id; }
-    int getPosX() const { return posX; }
-    int getPosY() const { return posY; }
-    PlantType getPlantType() const { return plantType; }
+    int getId() const;
+    int getPosX() const;
+    int getPosY() const;
+    PlantType getPlantType() const;
     const PlantTypeInfo& getPlantTypeInfo() const;
     
     // ============================================
     // GETTERS: Growth state
     // ============================================
-    float getGrowthProgress() const { return growthProgress; }
-    int getWaterLevel() const { return waterLevel; }
-    std::time_t getLastWateredTime() const { return lastWateredTime; }
-    float getDecayTimer() const { return decayTimer; }
-    float getGrowthModifier() const { return growthModifier; }
-    float getPendingGrowth() const { return pendingGrowth; }
+    float getGrowthProgress() const;
+    int getWaterLevel() const;
+    double getLastWateredTime() const;          // Game minutes
+    double getCurrentMinutes() const;           // Simulation timestamp for this tick
+    float getDecayTimer() const;
+    float getGrowthModifier() const;
+    float getPendingGrowth() const;
     
     bool canHarvest() const;
     int getSpriteIndex() const;
@@ -133,10 +105,10 @@ public:
     void setGrowthProgress(float progress);
     void addGrowthProgress(float progress);
     void setWaterLevel(int level);
-    void setLastWateredTime(std::time_t time);
+    void setLastWateredTime(double gameMinutes);
     void addDecayTimer(float minutes);
-    void setGrowthModifier(float modifier) { growthModifier = modifier; }
-    void setPendingGrowth(float growth) { pendingGrowth = growth; }
+    void setGrowthModifier(float modifier);
+    void setPendingGrowth(float growth);
     
     // ============================================
     // WATER MANAGEMENT
@@ -144,11 +116,51 @@ public:
     void updateWaterLevel(float deltaTime);
     bool needsWater() const;
     
+    // ============================================
+    // EVENT PREDICTION: For the plant event scheduler
+    // ============================================
+    float getCycleGrowthRate() const;       // Growth-cycle % per minute at current water level
+    float getTimeUntilNextEvent() const;    // Until next state transition or water threshold
+    
     // ============================================
     // SERIALIZATION: For save/load via Memento
     // ============================================
-    PlantData serialize() const;
-    static Plant* deserialize(const PlantData& data);
+    PlantData serialize() const { return serialize(capture()); }
+    PlantRecord capture() const;
+    static PlantData serialize(const PlantRecord& record);
+    static Plant* deserialize(const PlantData& data, PlantStore& store, int slot);
 };
 
+// ============================================
+// INLINE ACCESSORS: Read/write the store's arrays
+// ============================================
+inline bool Plant::isPlanted() const { return store->isOccupied(slot); }
+inline int Plant::getId() const { return store->ids[slot]; }
+inline int Plant::getPosX() const { return store->posX[slot]; }
+inline int Plant::getPosY() const { return store->posY[slot]; }
+inline PlantType Plant::getPlantType() const { return static_cast<PlantType>(store->plantType[slot]); }
+inline const PlantTypeInfo& Plant::getPlantTypeInfo() const { return PlantTypeDatabase::info(getPlantType()); }
+inline PlantStateId Plant::getStateId() const { return static_cast<PlantStateId>(store->stateId[slot]); }
+inline PlantState* Plant::getState() const { return PlantState::get(getStateId()); }
+
+inline float Plant::getGrowthProgress() const { return store->growthProgress[slot]; }
+inline int Plant::getWaterLevel() const { return store->waterLevel[slot]; }
+inline double Plant::getLastWateredTime() const { return store->lastWateredTime[slot]; }
+inline double Plant::getCurrentMinutes() const { return store->currentMinutes; }
+inline float Plant::getDecayTimer() const { return store->decayTimer[slot]; }
+inline float Plant::getGrowthModifier() const { return store->growthModifier[slot]; }
+inline float Plant::getPendingGrowth() const { return store->pendingGrowth[slot]; }
+
+inline void Plant::setGrowthModifier(float modifier) { store->growthModifier[slot] = modifier; }
+inline void Plant::setPendingGrowth(float growth) { store->pendingGrowth[slot] = growth; }
+
+// Inline and branch-free: PlantStore::advance asks for every plant it updates
+inline bool Plant::needsWater() const {
+    // Water level critically low, or the watering interval has passed
+    // (simulation time, so pause and warp are respected)
+    bool lowWater = getWaterLevel() < 30;
+    double hoursSinceWatered = (getCurrentMinutes() - getLastWateredTime()) / 60.0;
+    return lowWater | (hoursSinceWatered >= getPlantTypeInfo().waterIntervalHours);
+}
+
 #endif // PLANT_H
\ No newline at end of file
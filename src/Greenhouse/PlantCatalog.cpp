@@ -0,0 +1,502 @@
+#include "PlantTypes.h"
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <unordered_set>
+
+#ifdef __unix__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// ============================================
+// Binary catalog layout (host byte order)
+// ============================================
+const char CATALOG_MAGIC[4] = {'T', 'P', 'L', 'C'};
+const uint32_t CATALOG_VERSION = 1;
+const int CATALOG_NAME_BYTES = 48;  // Including the terminating zero
+
+struct CatalogHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t count;
+    uint32_t recordBytes;
+};
+
+struct CatalogRecord {
+    char name[CATALOG_NAME_BYTES];
+    uint32_t tier;
+    int32_t growthTimeHours;
+    int32_t waterIntervalHours;
+    int32_t seedCost;
+    int32_t sellPrice;
+    int32_t waterGracePeriodMinutes;
+    float decayRate;
+    float demandProbability;
+};
+
+static_assert(sizeof(CatalogHeader) == 16, "catalog header layout");
+static_assert(sizeof(CatalogRecord) == 80, "catalog record layout");
+
+const char* const TIER_NAMES[] = {"beginner", "intermediate", "advanced"};
+const int TIER_COUNT = 3;
+
+// ============================================
+// Read-only view of a whole file: mapped where the platform allows,
+// otherwise read into memory
+// ============================================
+class MappedFile {
+private:
+    const char* bytes;
+    size_t length;
+#ifdef __unix__
+    void* mapping;
+#endif
+    std::vector<char> buffer;
+
+public:
+    MappedFile() : bytes(nullptr), length(0) {
+#ifdef __unix__
+        mapping = nullptr;
+#endif
+    }
+
+    ~MappedFile() {
+#ifdef __unix__
+        if (mapping != nullptr) {
+            munmap(mapping, length);
+        }
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const std::string& path) {
+#ifdef __unix__
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat info;
+        bool ok = fstat(fd, &info) == 0;
+        length = ok ? static_cast<size_t>(info.st_size) : 0;
+        if (ok && length > 0) {
+            mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            ok = (mapping != MAP_FAILED);
+            if (!ok) {
+                mapping = nullptr;
+            }
+            bytes = static_cast<const char*>(mapping);
+        }
+        ::close(fd);
+        return ok;
+#else
+        std::ifstream in(path.c_str(), std::ios::binary);
+        if (!in) {
+            return false;
+        }
+        buffer.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        bytes = buffer.data();
+        length = buffer.size();
+        return true;
+#endif
+    }
+
+    const char* data() const { return bytes; }
+    size_t size() const { return length; }
+};
+
+std::string_view trim(std::string_view text) {
+    size_t begin = text.find_first_not_of(" \t\r");
+    if (begin == std::string_view::npos) {
+        return std::string_view();
+    }
+    size_t end = text.find_last_not_of(" \t\r");
+    return text.substr(begin, end - begin + 1);
+}
+
+bool parseInt(std::string_view field, int& value) {
+    std::string text(field);
+    char* end = nullptr;
+    errno = 0;
+    long parsed = std::strtol(text.c_str(), &end, 10);
+    // long is 64-bit here, so out-of-range ints would otherwise wrap
+    if (errno == ERANGE || parsed < std::numeric_limits<int>::min() ||
+        parsed > std::numeric_limits<int>::max()) {
+        return false;
+    }
+    value = static_cast<int>(parsed);
+    return !text.empty() && *end == '\0';
+}
+
+bool parseFloat(std::string_view field, float& value) {
+    std::string text(field);
+    char* end = nullptr;
+    value = std::strtof(text.c_str(), &end);
+    return !text.empty() && *end == '\0';
+}
+
+bool parseTier(std::string_view field, PlantTier& tier) {
+    for (int i = 0; i < TIER_COUNT; i++) {
+        std::string_view name(TIER_NAMES[i]);
+        bool match = field.size() == name.size();
+        for (size_t c = 0; match && c < name.size(); c++) {
+            match = std::tolower(static_cast<unsigned char>(field[c])) == name[c];
+        }
+        if (match) {
+            tier = static_cast<PlantTier>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool readBinary(const char* data, size_t size, std::vector<PlantTypeInfo>& species, std::string& error) {
+    CatalogHeader header;
+    if (size < sizeof(header)) {
+        error = "truncated header";
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (header.version != CATALOG_VERSION || header.recordBytes != sizeof(CatalogRecord)) {
+        error = "unsupported binary version";
+        return false;
+    }
+    if (header.count > static_cast<uint32_t>(MAX_PLANT_TYPES) ||
+        size != sizeof(header) + static_cast<size_t>(header.count) * sizeof(CatalogRecord)) {
+        error = "record count does not match the file size";
+        return false;
+    }
+
+    species.clear();
+    species.reserve(header.count);
+    const char* records = data + sizeof(header);
+    for (uint32_t i = 0; i < header.count; i++) {
+        CatalogRecord record;
+        std::memcpy(&record, records + i * sizeof(CatalogRecord), sizeof(record));
+        if (record.tier >= static_cast<uint32_t>(TIER_COUNT)) {
+            error = "record " + std::to_string(i + 1) + ": bad tier";
+            return false;
+        }
+
+        PlantTypeInfo info;
+        info.type = static_cast<PlantType>(i);
+        info.name.assign(record.name, strnlen(record.name, CATALOG_NAME_BYTES));
+        info.tier = static_cast<PlantTier>(record.tier);
+        info.growthTimeHours = record.growthTimeHours;
+        info.waterIntervalHours = record.waterIntervalHours;
+        info.seedCost = record.seedCost;
+        info.sellPrice = record.sellPrice;
+        info.waterGracePeriodMinutes = record.waterGracePeriodMinutes;
+        info.decayRate = record.decayRate;
+        info.demandProbability = record.demandProbability;
+        species.push_back(info);
+    }
+    return true;
+}
+
+bool readText(const char* data, size_t size, std::vector<PlantTypeInfo>& species, std::string& error) {
+    const int FIELD_COUNT = 9;
+    std::string_view text(data, size);
+    species.clear();
+
+    int lineNumber = 0;
+    while (!text.empty()) {
+        size_t newline = text.find('\n');
+        std::string_view line = text.substr(0, newline);
+        text = (newline == std::string_view::npos) ? std::string_view() : text.substr(newline + 1);
+        lineNumber++;
+
+        line = trim(line.substr(0, line.find('#')));
+        if (line.empty()) {
+            continue;
+        }
+
+        std::string_view fields[FIELD_COUNT];
+        int fieldCount = 0;
+        while (fieldCount < FIELD_COUNT) {
+            size_t comma = line.find(',');
+            fields[fieldCount++] = trim(line.substr(0, comma));
+            if (comma == std::string_view::npos) {
+                line = std::string_view();
+                break;
+            }
+            line = line.substr(comma + 1);
+        }
+
+        PlantTypeInfo info;
+        info.type = static_cast<PlantType>(species.size());
+        info.name = std::string(fields[0]);
+        if (fieldCount != FIELD_COUNT || !line.empty()) {
+            error = "line " + std::to_string(lineNumber) + ": expected " + std::to_string(FIELD_COUNT) +
+                    " fields (name, tier, growth hours, water hours, seed cost, sell price, "
+                    "grace minutes, decay rate, demand)";
+            return false;
+        }
+        bool ok = parseTier(fields[1], info.tier) &&
+                  parseInt(fields[2], info.growthTimeHours) &&
+                  parseInt(fields[3], info.waterIntervalHours) &&
+                  parseInt(fields[4], info.seedCost) &&
+                  parseInt(fields[5], info.sellPrice) &&
+                  parseInt(fields[6], info.waterGracePeriodMinutes) &&
+                  parseFloat(fields[7], info.decayRate) &&
+                  parseFloat(fields[8], info.demandProbability);
+        if (!ok) {
+            error = "line " + std::to_string(lineNumber) + ": unknown tier or a number that is "
+                    "malformed or out of range";
+            return false;
+        }
+        species.push_back(info);
+    }
+    return true;
+}
+
+// ============================================
+// Name hashing
+// ============================================
+
+// FNV-1a with a final mix; the high half picks the bucket
+uint64_t hashName(std::string_view name) {
+    uint64_t hash = 1469598103934665603ULL;
+    for (char c : name) {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ULL;
+    }
+    hash ^= hash >> 29;
+    hash *= 0xBF58476D1CE4E5B9ULL;
+    return hash ^ (hash >> 32);
+}
+
+uint32_t nameBucket(uint64_t hash, size_t bucketCount) {
+    return static_cast<uint32_t>(hash >> 32) & static_cast<uint32_t>(bucketCount - 1);
+}
+
+uint32_t nameSlot(uint64_t hash, uint32_t displacement, size_t slotCount) {
+    uint32_t first = static_cast<uint32_t>(hash);
+    uint32_t step = static_cast<uint32_t>(hash >> 17) | 1u;
+    return (first + displacement * step) & static_cast<uint32_t>(slotCount - 1);
+}
+
+size_t powerOfTwoAtLeast(size_t value) {
+    size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+} // namespace
+
+// ============================================
+// CATALOG
+// ============================================
+
+PlantCatalog::PlantCatalog(std::vector<PlantTypeInfo> species) : entries(std::move(species)) {
+    std::vector<double> weights(entries.size());
+    for (size_t i = 0; i < entries.size(); i++) {
+        PlantTypeInfo& info = entries[i];
+        info.type = static_cast<PlantType>(i);
+
+        // Same float arithmetic the update loop used
+        info.growthPerMinute = 100.0f / (info.growthTimeHours * 60.0f);
+        info.depletionPerHour = 100.0f / static_cast<float>(info.waterIntervalHours);
+        info.waterIntervalMinutes = info.waterIntervalHours * 60.0;
+
+        weights[i] = info.demandProbability;
+    }
+
+    demandSampler.build(weights.data(), size());
+    buildNameIndex();
+}
+
+// Buckets of about four names are placed largest first; each tries
+// displacements until all its names land in free slots. Twice as many
+// slots as names keeps that quick; the slot table doubles in the rare
+// case a bucket runs out of displacements.
+void PlantCatalog::buildNameIndex() {
+    const uint32_t MAX_DISPLACEMENT = 0xFFFF;
+    size_t count = entries.size();
+    size_t bucketCount = powerOfTwoAtLeast((count + 3) / 4);
+    size_t slotCount = powerOfTwoAtLeast(2 * count);
+
+    std::vector<uint64_t> hashes(count);
+    std::vector<std::vector<int>> buckets(bucketCount);
+    for (size_t i = 0; i < count; i++) {
+        hashes[i] = hashName(entries[i].name);
+        buckets[nameBucket(hashes[i], bucketCount)].push_back(static_cast<int>(i));
+    }
+
+    std::vector<int> order(bucketCount);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&buckets](int a, int b) {
+        return buckets[a].size() > buckets[b].size();
+    });
+
+    for (;; slotCount <<= 1) {
+        nameSlots.assign(slotCount, -1);
+        nameDisplacement.assign(bucketCount, 0);
+
+        bool placedAll = true;
+        for (int bucket : order) {
+            const std::vector<int>& rows = buckets[bucket];
+            bool placed = rows.empty();
+            for (uint32_t displacement = 0; !placed && displacement <= MAX_DISPLACEMENT; displacement++) {
+                size_t taken = 0;
+                for (; taken < rows.size(); taken++) {
+                    int16_t& slot = nameSlots[nameSlot(hashes[rows[taken]], displacement, slotCount)];
+                    if (slot >= 0) {
+                        break;
+                    }
+                    slot = static_cast<int16_t>(rows[taken]);
+                }
+                placed = (taken == rows.size());
+                if (!placed) {
+                    // Undo this attempt's claims
+                    for (size_t i = 0; i < taken; i++) {
+                        nameSlots[nameSlot(hashes[rows[i]], displacement, slotCount)] = -1;
+                    }
+                } else {
+                    nameDisplacement[bucket] = static_cast<uint16_t>(displacement);
+                }
+            }
+            if (!placed) {
+                placedAll = false;
+                break;
+            }
+        }
+        if (placedAll) {
+            return;
+        }
+    }
+}
+
+bool PlantCatalog::findByName(std::string_view name, PlantType& type) const {
+    uint64_t hash = hashName(name);
+    uint32_t displacement = nameDisplacement[nameBucket(hash, nameDisplacement.size())];
+    int row = nameSlots[nameSlot(hash, displacement, nameSlots.size())];
+    if (row < 0 || entries[row].name != name) {
+        return false;
+    }
+    type = static_cast<PlantType>(row);
+    return true;
+}
+
+int PlantCatalog::getNameBucket(std::string_view name) const {
+    return static_cast<int>(nameBucket(hashName(name), nameDisplacement.size()));
+}
+
+// ============================================
+// FILES
+// ============================================
+
+bool PlantCatalog::readFile(const std::string& path, std::vector<PlantTypeInfo>& species, std::string& error) {
+    MappedFile file;
+    if (!file.open(path)) {
+        error = "cannot read file";
+        return false;
+    }
+
+    bool binary = file.size() >= sizeof(CATALOG_MAGIC) &&
+                  std::memcmp(file.data(), CATALOG_MAGIC, sizeof(CATALOG_MAGIC)) == 0;
+    bool parsed = binary ? readBinary(file.data(), file.size(), species, error)
+                         : readText(file.data(), file.size(), species, error);
+    return parsed && validate(species, error);
+}
+
+bool PlantCatalog::validate(const std::vector<PlantTypeInfo>& species, std::string& error) {
+    if (species.empty() || species.size() > static_cast<size_t>(MAX_PLANT_TYPES)) {
+        error = "a catalog needs 1 to " + std::to_string(MAX_PLANT_TYPES) + " species";
+        return false;
+    }
+
+    std::unordered_set<std::string> names;
+    double totalDemand = 0.0;  // Summed like AliasTable does
+    for (const PlantTypeInfo& info : species) {
+        const std::string& name = info.name;
+        if (name.empty() || name.size() >= static_cast<size_t>(CATALOG_NAME_BYTES) ||
+            name.find_first_of(",#\n") != std::string::npos) {
+            error = "bad species name '" + name + "'";
+            return false;
+        }
+        if (!names.insert(name).second) {
+            error = "duplicate species " + name;
+            return false;
+        }
+        if (info.growthTimeHours <= 0 || info.waterIntervalHours <= 0 || info.seedCost < 0 ||
+            info.sellPrice < 0 || info.waterGracePeriodMinutes < 0 ||
+            !(info.decayRate >= 0.0f && info.decayRate <= 1.0f)) {
+            error = "out-of-range values for " + name;
+            return false;
+        }
+        if (!std::isfinite(info.demandProbability) || info.demandProbability < 0.0f) {
+            error = "demand for " + name + " must be a finite value >= 0";
+            return false;
+        }
+        totalDemand += info.demandProbability;
+    }
+    // The demand sampler needs something to pick from
+    if (!(totalDemand > 0.0) || !std::isfinite(totalDemand)) {
+        error = "total demand must be positive (every species has demand 0)";
+        return false;
+    }
+    return true;
+}
+
+bool PlantCatalog::writeBinary(const std::string& path) const {
+    std::ofstream out(path.c_str(), std::ios::binary | std::ios::trunc);
+    if (!out) {
+        return false;
+    }
+
+    CatalogHeader header;
+    std::memcpy(header.magic, CATALOG_MAGIC, sizeof(CATALOG_MAGIC));
+    header.version = CATALOG_VERSION;
+    header.count = static_cast<uint32_t>(entries.size());
+    header.recordBytes = sizeof(CatalogRecord);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    for (const PlantTypeInfo& info : entries) {
+        CatalogRecord record;
+        std::memset(&record, 0, sizeof(record));
+        std::memcpy(record.name, info.name.data(), std::min(info.name.size(), sizeof(record.name) - 1));
+        record.tier = static_cast<uint32_t>(info.tier);
+        record.growthTimeHours = info.growthTimeHours;
+        record.waterIntervalHours = info.waterIntervalHours;
+        record.seedCost = info.seedCost;
+        record.sellPrice = info.sellPrice;
+        record.waterGracePeriodMinutes = info.waterGracePeriodMinutes;
+        record.decayRate = info.decayRate;
+        record.demandProbability = info.demandProbability;
+        out.write(reinterpret_cast<const char*>(&record), sizeof(record));
+    }
+    return static_cast<bool>(out);
+}
+
+bool PlantCatalog::writeText(const std::string& path) const {
+    std::ofstream out(path.c_str(), std::ios::trunc);
+    if (!out) {
+        return false;
+    }
+
+    // Enough digits that decayRate and demand read back to the same floats
+    out.precision(std::numeric_limits<float>::max_digits10);
+    out << "# name, tier, growth hours, water hours, seed cost, sell price, grace minutes, decay rate, demand %\n";
+    for (const PlantTypeInfo& info : entries) {
+        out << info.name << ", " << TIER_NAMES[static_cast<int>(info.tier)] << ", "
+            << info.growthTimeHours << ", " << info.waterIntervalHours << ", "
+            << info.seedCost << ", " << info.sellPrice << ", " << info.waterGracePeriodMinutes << ", "
+            << info.decayRate << ", " << info.demandProbability << "\n";
+    }
+    return static_cast<bool>(out);
+}
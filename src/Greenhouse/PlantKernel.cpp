@@ -0,0 +1,436 @@
+#include "PlantKernel.h"
+#include "Patterns/State/PlantStateMachine.h"
+#include <algorithm>
+#include <limits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define TEMPLANTER_KERNEL_X86 1
+#include <immintrin.h>
+#endif
+
+// ============================================
+// STATE RULES
+// ============================================
+// What each state's update() does besides the shared growth cycle,
+// as compile-time constants for the kernel instantiations
+namespace {
+
+enum class StateGrowth {
+    NONE,
+    GERMINATE,       // Seed: +deltaTime
+    WATER_DEPENDENT  // Growing: full / half / negative by water level
+};
+
+template <PlantStateId State>
+struct StateRules {
+    static constexpr bool CONSUMES_WATER = PlantStateClass<State>::Type::CONSUMES_WATER;
+    static constexpr bool ACCUMULATES_DECAY = (State == PlantStateId::RIPE || State == PlantStateId::DECAYING);
+    static constexpr StateGrowth GROWTH = State == PlantStateId::SEED    ? StateGrowth::GERMINATE
+                                        : State == PlantStateId::GROWING ? StateGrowth::WATER_DEPENDENT
+                                                                         : StateGrowth::NONE;
+
+    // PlantStateMachine::detect as bounds, for the vector kernels:
+    // progress >= PROGRESS_AT, progress < PROGRESS_BELOW or decay > DECAY_AFTER
+    static constexpr float NEVER = std::numeric_limits<float>::infinity();
+    static constexpr float PROGRESS_AT = State == PlantStateId::SEED    ? PlantStateMachine::GERMINATION_PROGRESS
+                                       : State == PlantStateId::GROWING ? PlantStateMachine::RIPE_PROGRESS
+                                                                        : NEVER;
+    static constexpr float PROGRESS_BELOW = State == PlantStateId::GROWING ? 0.0f : -NEVER;
+    static constexpr float DECAY_AFTER = State == PlantStateId::RIPE     ? PlantStateMachine::RIPE_MINUTES
+                                       : State == PlantStateId::DECAYING ? PlantStateMachine::DEAD_MINUTES
+                                                                         : NEVER;
+};
+
+// GrowingState: above this grows normally, above zero grows slowly
+const int GROWING_LOW_WATER = 20;
+
+// Progress that Plant::logGrowthMilestone reports when crossed upwards
+const float GROWTH_MILESTONES[] = {25.0f, 50.0f, 75.0f, 100.0f};
+
+float clampProgress(float progress) {
+    return std::max(0.0f, std::min(100.0f, progress));
+}
+
+bool crossesMilestone(float from, float to) {
+    for (float milestone : GROWTH_MILESTONES) {
+        if (from < milestone && to >= milestone) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// ============================================
+// SCALAR (reference)
+// ============================================
+template <PlantStateId State, GrowthCycleId Cycle>
+void advanceScalar(const PlantLanes& lanes, int begin) {
+    typedef StateRules<State> Rules;
+    typedef GrowthCycleTraits<Cycle> CycleTraits;
+
+    for (int i = begin; i < lanes.count; i++) {
+        float dt = lanes.deltaTime[i];
+        int water = lanes.waterLevel[i];
+        float start = lanes.growthProgress[i];
+
+        // Growth cycle
+        float modifier = water < GrowthCycle::LOW_WATER_LEVEL ? CycleTraits::DRY_MODIFIER : CycleTraits::WET_MODIFIER;
+        float pending = lanes.growthPerMinute[i] * dt * modifier;
+        float progress = clampProgress(start + pending);
+        float cycleProgress = progress;
+
+        lanes.growthModifier[i] = modifier;
+        lanes.pendingGrowth[i] = pending;
+        lanes.cycleProgress[i] = progress;
+
+        // Water depletion (whole percents; the fraction carries over)
+        if constexpr (Rules::CONSUMES_WATER) {
+            float deficit = lanes.waterDeficit[i] + lanes.depletionRate[i] * (dt / 60.0f);
+            int depletion = static_cast<int>(deficit);
+            deficit -= depletion;
+            water = std::max(0, water - depletion);
+
+            lanes.waterDeficit[i] = deficit;
+            lanes.waterLevel[i] = water;
+        }
+
+        // State growth
+        if constexpr (Rules::GROWTH == StateGrowth::GERMINATE) {
+            progress = clampProgress(progress + dt);
+        } else if constexpr (Rules::GROWTH == StateGrowth::WATER_DEPENDENT) {
+            float growth;
+            if (water > GROWING_LOW_WATER) {
+                growth = dt;
+            } else if (water > 0) {
+                growth = dt * 0.5f;
+            } else {
+                growth = dt * -0.2f;
+            }
+            progress = clampProgress(progress + growth);
+        }
+
+        if constexpr (Rules::ACCUMULATES_DECAY) {
+            lanes.decayTimer[i] += dt;
+        }
+
+        lanes.growthProgress[i] = progress;
+        lanes.attention[i] = crossesMilestone(start, cycleProgress) || crossesMilestone(cycleProgress, progress) ||
+                             PlantStateMachine::detect(State, progress, lanes.decayTimer[i]) != PlantStateEvent::NONE;
+    }
+}
+
+#ifdef TEMPLANTER_KERNEL_X86
+
+// ============================================
+// SSE2 (4 lanes)
+// ============================================
+__attribute__((target("sse2")))
+inline __m128 selectPs(__m128 mask, __m128 ifTrue, __m128 ifFalse) {
+    return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+}
+
+__attribute__((target("sse2")))
+inline __m128 clampProgressSse(__m128 progress) {
+    return _mm_max_ps(_mm_min_ps(progress, _mm_set1_ps(100.0f)), _mm_setzero_ps());
+}
+
+__attribute__((target("sse2")))
+inline __m128 crossesMilestoneSse(__m128 from, __m128 to) {
+    __m128 crossed = _mm_setzero_ps();
+    for (float milestone : GROWTH_MILESTONES) {
+        __m128 value = _mm_set1_ps(milestone);
+        crossed = _mm_or_ps(crossed, _mm_and_ps(_mm_cmplt_ps(from, value), _mm_cmpge_ps(to, value)));
+    }
+    return crossed;
+}
+
+template <PlantStateId State, GrowthCycleId Cycle>
+__attribute__((target("sse2")))
+int advanceSse2(const PlantLanes& lanes) {
+    typedef StateRules<State> Rules;
+    typedef GrowthCycleTraits<Cycle> CycleTraits;
+
+    const __m128i lowWater = _mm_set1_epi32(GrowthCycle::LOW_WATER_LEVEL);
+    const __m128i growingLowWater = _mm_set1_epi32(GROWING_LOW_WATER);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 minutesPerHour = _mm_set1_ps(60.0f);
+    const __m128 dryModifier = _mm_set1_ps(CycleTraits::DRY_MODIFIER);
+    const __m128 wetModifier = _mm_set1_ps(CycleTraits::WET_MODIFIER);
+
+    int i = 0;
+    for (; i + 4 <= lanes.count; i += 4) {
+        __m128 dt = _mm_loadu_ps(lanes.deltaTime + i);
+        __m128i water = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lanes.waterLevel + i));
+        __m128 start = _mm_loadu_ps(lanes.growthProgress + i);
+
+        // Growth cycle
+        __m128 dry = _mm_castsi128_ps(_mm_cmplt_epi32(water, lowWater));
+        __m128 modifier = selectPs(dry, dryModifier, wetModifier);
+        __m128 pending = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(lanes.growthPerMinute + i), dt), modifier);
+        __m128 progress = clampProgressSse(_mm_add_ps(start, pending));
+        __m128 cycleProgress = progress;
+
+        _mm_storeu_ps(lanes.growthModifier + i, modifier);
+        _mm_storeu_ps(lanes.pendingGrowth + i, pending);
+        _mm_storeu_ps(lanes.cycleProgress + i, progress);
+
+        // Water depletion
+        if constexpr (Rules::CONSUMES_WATER) {
+            __m128 deficit = _mm_add_ps(_mm_loadu_ps(lanes.waterDeficit + i),
+                                        _mm_mul_ps(_mm_loadu_ps(lanes.depletionRate + i),
+                                                   _mm_div_ps(dt, minutesPerHour)));
+            __m128i depletion = _mm_cvttps_epi32(deficit);
+            deficit = _mm_sub_ps(deficit, _mm_cvtepi32_ps(depletion));
+            water = _mm_sub_epi32(water, depletion);
+            water = _mm_and_si128(water, _mm_cmpgt_epi32(water, zero));  // max(0, water)
+
+            _mm_storeu_ps(lanes.waterDeficit + i, deficit);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes.waterLevel + i), water);
+        }
+
+        // State growth
+        if constexpr (Rules::GROWTH == StateGrowth::GERMINATE) {
+            progress = clampProgressSse(_mm_add_ps(progress, dt));
+        } else if constexpr (Rules::GROWTH == StateGrowth::WATER_DEPENDENT) {
+            __m128 wet = _mm_castsi128_ps(_mm_cmpgt_epi32(water, growingLowWater));
+            __m128 damp = _mm_castsi128_ps(_mm_cmpgt_epi32(water, zero));
+            __m128 growth = selectPs(wet, dt,
+                                     selectPs(damp, _mm_mul_ps(dt, _mm_set1_ps(0.5f)),
+                                                    _mm_mul_ps(dt, _mm_set1_ps(-0.2f))));
+            progress = clampProgressSse(_mm_add_ps(progress, growth));
+        }
+
+        __m128 decay = _mm_loadu_ps(lanes.decayTimer + i);
+        if constexpr (Rules::ACCUMULATES_DECAY) {
+            decay = _mm_add_ps(decay, dt);
+            _mm_storeu_ps(lanes.decayTimer + i, decay);
+        }
+
+        _mm_storeu_ps(lanes.growthProgress + i, progress);
+
+        // Attention: milestones, then the state's transition bounds
+        __m128 attention = _mm_or_ps(crossesMilestoneSse(start, cycleProgress),
+                                     crossesMilestoneSse(cycleProgress, progress));
+        attention = _mm_or_ps(attention, _mm_cmpge_ps(progress, _mm_set1_ps(Rules::PROGRESS_AT)));
+        attention = _mm_or_ps(attention, _mm_cmplt_ps(progress, _mm_set1_ps(Rules::PROGRESS_BELOW)));
+        attention = _mm_or_ps(attention, _mm_cmpgt_ps(decay, _mm_set1_ps(Rules::DECAY_AFTER)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes.attention + i), _mm_castps_si128(attention));
+    }
+    return i;
+}
+
+// ============================================
+// AVX2 (8 lanes)
+// ============================================
+__attribute__((target("avx2")))
+inline __m256 clampProgressAvx(__m256 progress) {
+    return _mm256_max_ps(_mm256_min_ps(progress, _mm256_set1_ps(100.0f)), _mm256_setzero_ps());
+}
+
+__attribute__((target("avx2")))
+inline __m256 crossesMilestoneAvx(__m256 from, __m256 to) {
+    __m256 crossed = _mm256_setzero_ps();
+    for (float milestone : GROWTH_MILESTONES) {
+        __m256 value = _mm256_set1_ps(milestone);
+        crossed = _mm256_or_ps(crossed, _mm256_and_ps(_mm256_cmp_ps(from, value, _CMP_LT_OQ),
+                                                      _mm256_cmp_ps(to, value, _CMP_GE_OQ)));
+    }
+    return crossed;
+}
+
+template <PlantStateId State, GrowthCycleId Cycle>
+__attribute__((target("avx2")))
+int advanceAvx2(const PlantLanes& lanes) {
+    typedef StateRules<State> Rules;
+    typedef GrowthCycleTraits<Cycle> CycleTraits;
+
+    const __m256i dryBelow = _mm256_set1_epi32(GrowthCycle::LOW_WATER_LEVEL);
+    const __m256i growingLowWater = _mm256_set1_epi32(GROWING_LOW_WATER);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256 minutesPerHour = _mm256_set1_ps(60.0f);
+    const __m256 dryModifier = _mm256_set1_ps(CycleTraits::DRY_MODIFIER);
+    const __m256 wetModifier = _mm256_set1_ps(CycleTraits::WET_MODIFIER);
+
+    int i = 0;
+    for (; i + 8 <= lanes.count; i += 8) {
+        __m256 dt = _mm256_loadu_ps(lanes.deltaTime + i);
+        __m256i water = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lanes.waterLevel + i));
+        __m256 start = _mm256_loadu_ps(lanes.growthProgress + i);
+
+        // Growth cycle
+        __m256 dry = _mm256_castsi256_ps(_mm256_cmpgt_epi32(dryBelow, water));
+        __m256 modifier = _mm256_blendv_ps(wetModifier, dryModifier, dry);
+        __m256 pending = _mm256_mul_ps(_mm256_mul_ps(_mm256_loadu_ps(lanes.growthPerMinute + i), dt), modifier);
+        __m256 progress = clampProgressAvx(_mm256_add_ps(start, pending));
+        __m256 cycleProgress = progress;
+
+        _mm256_storeu_ps(lanes.growthModifier + i, modifier);
+        _mm256_storeu_ps(lanes.pendingGrowth + i, pending);
+        _mm256_storeu_ps(lanes.cycleProgress + i, progress);
+
+        // Water depletion
+        if constexpr (Rules::CONSUMES_WATER) {
+            __m256 deficit = _mm256_add_ps(_mm256_loadu_ps(lanes.waterDeficit + i),
+                                           _mm256_mul_ps(_mm256_loadu_ps(lanes.depletionRate + i),
+                                                         _mm256_div_ps(dt, minutesPerHour)));
+            __m256i depletion = _mm256_cvttps_epi32(deficit);
+            deficit = _mm256_sub_ps(deficit, _mm256_cvtepi32_ps(depletion));
+            water = _mm256_max_epi32(_mm256_sub_epi32(water, depletion), zero);
+
+            _mm256_storeu_ps(lanes.waterDeficit + i, deficit);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes.waterLevel + i), water);
+        }
+
+        // State growth
+        if constexpr (Rules::GROWTH == StateGrowth::GERMINATE) {
+            progress = clampProgressAvx(_mm256_add_ps(progress, dt));
+        } else if constexpr (Rules::GROWTH == StateGrowth::WATER_DEPENDENT) {
+            __m256 wet = _mm256_castsi256_ps(_mm256_cmpgt_epi32(water, growingLowWater));
+            __m256 damp = _mm256_castsi256_ps(_mm256_cmpgt_epi32(water, zero));
+            __m256 growth = _mm256_blendv_ps(
+                _mm256_blendv_ps(_mm256_mul_ps(dt, _mm256_set1_ps(-0.2f)),
+                                 _mm256_mul_ps(dt, _mm256_set1_ps(0.5f)), damp),
+                dt, wet);
+            progress = clampProgressAvx(_mm256_add_ps(progress, growth));
+        }
+
+        __m256 decay = _mm256_loadu_ps(lanes.decayTimer + i);
+        if constexpr (Rules::ACCUMULATES_DECAY) {
+            decay = _mm256_add_ps(decay, dt);
+            _mm256_storeu_ps(lanes.decayTimer + i, decay);
+        }
+
+        _mm256_storeu_ps(lanes.growthProgress + i, progress);
+
+        // Attention: milestones, then the state's transition bounds
+        __m256 attention = _mm256_or_ps(crossesMilestoneAvx(start, cycleProgress),
+                                        crossesMilestoneAvx(cycleProgress, progress));
+        attention = _mm256_or_ps(attention, _mm256_cmp_ps(progress, _mm256_set1_ps(Rules::PROGRESS_AT), _CMP_GE_OQ));
+        attention = _mm256_or_ps(attention, _mm256_cmp_ps(progress, _mm256_set1_ps(Rules::PROGRESS_BELOW), _CMP_LT_OQ));
+        attention = _mm256_or_ps(attention, _mm256_cmp_ps(decay, _mm256_set1_ps(Rules::DECAY_AFTER), _CMP_GT_OQ));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes.attention + i), _mm256_castps_si256(attention));
+    }
+    return i;
+}
+
+#endif // TEMPLANTER_KERNEL_X86
+
+// ============================================
+// JUMP TABLE
+// ============================================
+// One entry per (ISA, state, cycle); unsupported ISAs fall back to scalar
+typedef void (*KernelFunction)(const PlantLanes& lanes);
+
+const int ISA_COUNT = 3;
+const int STATE_COUNT = static_cast<int>(PlantStateId::COUNT);
+
+template <KernelIsa Isa, PlantStateId State, GrowthCycleId Cycle>
+void runKernel(const PlantLanes& lanes) {
+    int done = 0;
+#ifdef TEMPLANTER_KERNEL_X86
+    if constexpr (Isa == KernelIsa::AVX2) {
+        done = advanceAvx2<State, Cycle>(lanes);
+    } else if constexpr (Isa == KernelIsa::SSE2) {
+        done = advanceSse2<State, Cycle>(lanes);
+    }
+#endif
+
+    // Leftover lanes (and non-x86 builds)
+    advanceScalar<State, Cycle>(lanes, done);
+}
+
+struct KernelTable {
+    KernelFunction entries[ISA_COUNT][STATE_COUNT][GROWTH_CYCLE_COUNT];
+};
+
+template <KernelIsa Isa, PlantStateId State>
+void fillCycles(KernelTable& table) {
+    KernelFunction* row = table.entries[static_cast<int>(Isa)][static_cast<int>(State)];
+    row[static_cast<int>(GrowthCycleId::NORMAL)] = &runKernel<Isa, State, GrowthCycleId::NORMAL>;
+    row[static_cast<int>(GrowthCycleId::BOOSTED)] = &runKernel<Isa, State, GrowthCycleId::BOOSTED>;
+}
+
+template <KernelIsa Isa>
+void fillStates(KernelTable& table) {
+    fillCycles<Isa, PlantStateId::SEED>(table);
+    fillCycles<Isa, PlantStateId::GROWING>(table);
+    fillCycles<Isa, PlantStateId::RIPE>(table);
+    fillCycles<Isa, PlantStateId::DECAYING>(table);
+    fillCycles<Isa, PlantStateId::DEAD>(table);
+}
+
+KernelTable buildKernelTable() {
+    static_assert(STATE_COUNT == 5 && GROWTH_CYCLE_COUNT == 2, "kernel table is missing a state or cycle");
+    KernelTable table;
+    fillStates<KernelIsa::SCALAR>(table);
+    fillStates<KernelIsa::SSE2>(table);
+    fillStates<KernelIsa::AVX2>(table);
+    return table;
+}
+
+const KernelTable kernels = buildKernelTable();
+
+KernelIsa selectedIsa = PlantKernel::getBestIsa();
+
+} // namespace
+
+// ============================================
+// DISPATCH
+// ============================================
+
+void PlantKernel::advance(PlantStateId state, GrowthCycleId cycle, const PlantLanes& lanes) {
+    // setIsa only selects supported ISAs
+    kernels.entries[static_cast<int>(selectedIsa)][static_cast<int>(state)][static_cast<int>(cycle)](lanes);
+}
+
+void PlantKernel::advance(PlantStateId state, GrowthCycleId cycle, const PlantLanes& lanes, KernelIsa isa) {
+    if (!isSupported(isa)) {
+        isa = KernelIsa::SCALAR;
+    }
+    kernels.entries[static_cast<int>(isa)][static_cast<int>(state)][static_cast<int>(cycle)](lanes);
+}
+
+KernelIsa PlantKernel::getBestIsa() {
+    if (isSupported(KernelIsa::AVX2)) {
+        return KernelIsa::AVX2;
+    }
+    if (isSupported(KernelIsa::SSE2)) {
+        return KernelIsa::SSE2;
+    }
+    return KernelIsa::SCALAR;
+}
+
+KernelIsa PlantKernel::getIsa() {
+    return selectedIsa;
+}
+
+void PlantKernel::setIsa(KernelIsa isa) {
+    selectedIsa = isSupported(isa) ? isa : getBestIsa();
+}
+
+bool PlantKernel::isSupported(KernelIsa isa) {
+#ifdef TEMPLANTER_KERNEL_X86
+    __builtin_cpu_init();  // May run from a static initializer
+#endif
+    switch (isa) {
+        case KernelIsa::SCALAR:
+            return true;
+#ifdef TEMPLANTER_KERNEL_X86
+        case KernelIsa::SSE2:
+            return __builtin_cpu_supports("sse2");
+        case KernelIsa::AVX2:
+            return __builtin_cpu_supports("avx2");
+#endif
+        default:
+            return false;
+    }
+}
+
+const char* PlantKernel::getIsaName(KernelIsa isa) {
+    switch (isa) {
+        case KernelIsa::SCALAR: return "scalar";
+        case KernelIsa::SSE2:   return "sse2";
+        case KernelIsa::AVX2:   return "avx2";
+    }
+    return "unknown";
+}
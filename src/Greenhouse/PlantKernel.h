@@ -0,0 +1,66 @@
+#ifndef PLANTKERNEL_H
+#define PLANTKERNEL_H
+
+#include "Patterns/State/PlantState.h"
+#include "Patterns/Template/GrowthCycle.h"
+
+// ============================================
+// PLANT LANES (Structure of Arrays)
+// ============================================
+// One lane per plant. All lanes in a batch share the same state and
+// growth cycle; per-type rates are gathered into their own lanes.
+struct PlantLanes {
+    int count;
+
+    // In/out
+    float* growthProgress;
+    int* waterLevel;
+    float* waterDeficit;
+    float* decayTimer;
+
+    // Out
+    float* growthModifier;
+    float* pendingGrowth;
+    float* cycleProgress;          // Progress after the growth cycle, before state growth
+    int* attention;                // Nonzero if the lane crossed a growth milestone or
+                                   // now meets its state's transition condition
+
+    // In
+    const float* deltaTime;        // Game minutes to advance each lane
+    const float* growthPerMinute;  // Plant type: growth cycle % per minute
+    const float* depletionRate;    // Plant type: water % per hour
+};
+
+// ============================================
+// PLANT KERNEL
+// ============================================
+// Batched version of the arithmetic in Plant::update (growth cycle,
+// water depletion, state growth and decay timers) for plants in one
+// state and growth cycle. Transitions, events and logging stay with the
+// caller, which only needs to visit the lanes flagged in attention.
+// Each (ISA, state, cycle) is its own template instantiation with the
+// state's rules and the cycle's modifiers folded in as constants; a jump
+// table picks it per batch. SSE2 and AVX2 paths are picked at runtime;
+// the scalar path is the reference and handles leftover lanes.
+enum class KernelIsa {
+    SCALAR,
+    SSE2,
+    AVX2
+};
+
+class PlantKernel {
+public:
+    // Advance every lane by its deltaTime using the selected ISA (or isa,
+    // falling back to scalar if this CPU lacks it)
+    static void advance(PlantStateId state, GrowthCycleId cycle, const PlantLanes& lanes);
+    static void advance(PlantStateId state, GrowthCycleId cycle, const PlantLanes& lanes, KernelIsa isa);
+
+    // Best ISA this CPU supports; setIsa overrides it (benchmarks, comparisons)
+    static KernelIsa getBestIsa();
+    static KernelIsa getIsa();
+    static void setIsa(KernelIsa isa);
+    static bool isSupported(KernelIsa isa);
+    static const char* getIsaName(KernelIsa isa);
+};
+
+#endif // PLANTKERNEL_H
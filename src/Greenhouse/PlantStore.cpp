@@ -0,0 +1,293 @@
+#include "PlantStore.h"
+#include "Plant.h"
+#include "PlantKernel.h"
+#include "Patterns/Observer/Observer.h"
+#include "Core/Logger.h"
+#include <algorithm>
+
+namespace {
+
+// Lanes per pass of PlantStore::advance, small enough that the scratch
+// lanes stay in cache from gather through kernel, scatter and events
+const int BATCH_CHUNK = 1024;
+
+// Scratch lanes for PlantStore::advance, one set per thread
+struct PlantBatch {
+    std::vector<int> laneOf;          // Position in the request -> lane
+    std::vector<int> laneSlot;
+    std::vector<float> startProgress;
+    std::vector<float> growthProgress;
+    std::vector<int> waterLevel;
+    std::vector<float> waterDeficit;
+    std::vector<float> decayTimer;
+    std::vector<float> growthModifier;
+    std::vector<float> pendingGrowth;
+    std::vector<float> cycleProgress;
+    std::vector<int> attention;
+    std::vector<float> deltaTime;
+    std::vector<float> growthPerMinute;
+    std::vector<float> depletionRate;
+    
+    void resize(int count) {
+        laneOf.resize(count);
+        laneSlot.resize(count);
+        startProgress.resize(count);
+        growthProgress.resize(count);
+        waterLevel.resize(count);
+        waterDeficit.resize(count);
+        decayTimer.resize(count);
+        growthModifier.resize(count);
+        pendingGrowth.resize(count);
+        cycleProgress.resize(count);
+        attention.resize(count);
+        deltaTime.resize(count);
+        growthPerMinute.resize(count);
+        depletionRate.resize(count);
+    }
+    
+    PlantLanes lanes(int begin, int count) {
+        PlantLanes result;
+        result.count = count;
+        result.growthProgress = &growthProgress[begin];
+        result.waterLevel = &waterLevel[begin];
+        result.waterDeficit = &waterDeficit[begin];
+        result.decayTimer = &decayTimer[begin];
+        result.growthModifier = &growthModifier[begin];
+        result.pendingGrowth = &pendingGrowth[begin];
+        result.cycleProgress = &cycleProgress[begin];
+        result.attention = &attention[begin];
+        result.deltaTime = &deltaTime[begin];
+        result.growthPerMinute = &growthPerMinute[begin];
+        result.depletionRate = &depletionRate[begin];
+        return result;
+    }
+};
+
+thread_local PlantBatch threadBatch;
+
+} // namespace
+
+// ============================================
+// CONSTRUCTOR & DESTRUCTOR
+// ============================================
+PlantStore::PlantStore(int slotCount)
+    : capacity(slotCount), count(0), currentMinutes(0.0),
+      growthProgress(slotCount, 0.0f), waterLevel(slotCount, 0), waterDeficit(slotCount, 0.0f),
+      decayTimer(slotCount, 0.0f), growthModifier(slotCount, 1.0f), pendingGrowth(slotCount, 0.0f),
+      stateId(slotCount, 0), cycleId(slotCount, 0), plantType(slotCount, 0), flags(slotCount, 0),
+      ids(slotCount, 0), posX(slotCount, 0), posY(slotCount, 0),
+      lastWateredTime(slotCount, 0.0), subjects(slotCount, nullptr),
+      handles(nullptr), broadcast(nullptr) {
+    
+    handles = new Plant[slotCount];
+    for (int i = 0; i < slotCount; i++) {
+        handles[i].store = this;
+        handles[i].slot = i;
+    }
+}
+
+PlantStore::~PlantStore() {
+    for (PlantSubject* subject : subjects) {
+        delete subject;
+    }
+    delete[] handles;
+}
+
+// ============================================
+// SLOT MANAGEMENT
+// ============================================
+
+Plant* PlantStore::create(int slot, int plantId, PlantType type, int x, int y) {
+    if (isOccupied(slot)) {
+        remove(slot);
+    }
+    
+    growthProgress[slot] = 0.0f;
+    waterLevel[slot] = 100;
+    waterDeficit[slot] = 0.0f;
+    decayTimer[slot] = 0.0f;
+    growthModifier[slot] = 1.0f;
+    pendingGrowth[slot] = 0.0f;
+    stateId[slot] = static_cast<uint8_t>(PlantStateId::SEED);   // State Pattern: start as a seed
+    cycleId[slot] = static_cast<uint8_t>(GrowthCycleId::NORMAL);
+    plantType[slot] = static_cast<uint8_t>(type);
+    flags[slot] = FLAG_OCCUPIED;
+    
+    ids[slot] = plantId;
+    posX[slot] = static_cast<int16_t>(x);
+    posY[slot] = static_cast<int16_t>(y);
+    lastWateredTime[slot] = currentMinutes;
+    count++;
+    
+    Plant* plant = &handles[slot];
+    
+    LOG_DEBUG(PLANT, "🌱 Plant created: " << plant->getPlantTypeInfo().name 
+                     << " at (" << x << ", " << y << ")");
+    
+    return plant;
+}
+
+void PlantStore::remove(int slot) {
+    if (!isOccupied(slot)) {
+        return;
+    }
+    
+    flags[slot] = 0;
+    delete subjects[slot];
+    subjects[slot] = nullptr;
+    count--;
+}
+
+void PlantStore::clear() {
+    for (int slot = 0; slot < capacity; slot++) {
+        remove(slot);
+    }
+}
+
+void PlantStore::advance(const int* slots, const float* deltaTimes, int batchCount) {
+    // Each chunk finishes (events included) before the next starts, so
+    // events still follow request order
+    for (int begin = 0; begin < batchCount; begin += BATCH_CHUNK) {
+        advanceChunk(slots + begin, deltaTimes + begin, std::min(BATCH_CHUNK, batchCount - begin));
+    }
+}
+
+void PlantStore::advanceChunk(const int* slots, const float* deltaTimes, int batchCount) {
+    PlantBatch& batch = threadBatch;
+    batch.resize(batchCount);
+    
+    // Group lanes by (state, growth cycle), keeping request order within
+    // each group; every group runs through its own specialized kernel
+    const int stateCount = static_cast<int>(PlantStateId::COUNT);
+    const int groupCount = stateCount * GROWTH_CYCLE_COUNT;
+    int groupStart[static_cast<int>(PlantStateId::COUNT) * GROWTH_CYCLE_COUNT + 1] = {};
+    for (int i = 0; i < batchCount; i++) {
+        int slot = slots[i];
+        groupStart[stateId[slot] * GROWTH_CYCLE_COUNT + cycleId[slot] + 1]++;
+    }
+    for (int group = 0; group < groupCount; group++) {
+        groupStart[group + 1] += groupStart[group];
+    }
+    
+    int next[static_cast<int>(PlantStateId::COUNT) * GROWTH_CYCLE_COUNT];
+    std::copy(groupStart, groupStart + groupCount, next);
+    
+    // Gather (one catalog version for the whole batch, even across a reload)
+    const PlantCatalog& catalog = PlantTypeDatabase::catalog();
+    for (int i = 0; i < batchCount; i++) {
+        int slot = slots[i];
+        int lane = next[stateId[slot] * GROWTH_CYCLE_COUNT + cycleId[slot]]++;
+        
+        batch.laneOf[i] = lane;
+        batch.laneSlot[lane] = slot;
+        batch.startProgress[lane] = growthProgress[slot];
+        batch.growthProgress[lane] = growthProgress[slot];
+        batch.waterLevel[lane] = waterLevel[slot];
+        batch.waterDeficit[lane] = waterDeficit[slot];
+        batch.decayTimer[lane] = decayTimer[slot];
+        batch.deltaTime[lane] = deltaTimes[i];
+        const PlantTypeInfo& info = catalog.info(static_cast<PlantType>(plantType[slot]));
+        batch.growthPerMinute[lane] = info.growthPerMinute;
+        batch.depletionRate[lane] = info.depletionPerHour;
+    }
+    
+    // Arithmetic, one kernel call per group
+    for (int group = 0; group < groupCount; group++) {
+        int begin = groupStart[group];
+        int size = groupStart[group + 1] - begin;
+        if (size > 0) {
+            PlantKernel::advance(static_cast<PlantStateId>(group / GROWTH_CYCLE_COUNT),
+                                 static_cast<GrowthCycleId>(group % GROWTH_CYCLE_COUNT),
+                                 batch.lanes(begin, size));
+        }
+    }
+    
+    // Scatter
+    for (int lane = 0; lane < batchCount; lane++) {
+        int slot = batch.laneSlot[lane];
+        growthProgress[slot] = batch.growthProgress[lane];
+        waterLevel[slot] = batch.waterLevel[lane];
+        waterDeficit[slot] = batch.waterDeficit[lane];
+        decayTimer[slot] = batch.decayTimer[lane];
+        growthModifier[slot] = batch.growthModifier[lane];
+        pendingGrowth[slot] = batch.pendingGrowth[lane];
+    }
+    
+    // Milestones, transitions and events in request order. Only lanes the
+    // kernel flagged can log or change state; the rest can at most owe a
+    // notification, which hasPendingEvents reads from the flags and water
+    for (int i = 0; i < batchCount; i++) {
+        int slot = slots[i];
+        int lane = batch.laneOf[i];
+        Plant* plant = &handles[slot];
+        
+        if (batch.attention[lane] != 0) {
+            PlantStateId state = static_cast<PlantStateId>(stateId[slot]);
+            plant->logGrowthMilestone(batch.startProgress[lane], batch.cycleProgress[lane]);
+            if (state == PlantStateId::SEED || state == PlantStateId::GROWING) {
+                plant->logGrowthMilestone(batch.cycleProgress[lane], growthProgress[slot]);
+            }
+            
+            PlantState::get(state)->checkTransition(plant);
+            plant->notifyEvents();
+        } else if (hasPendingEvents(slot)) {
+            plant->notifyEvents();
+        }
+    }
+}
+
+bool PlantStore::hasPendingEvents(int slot) const {
+    // The conditions of Plant::notifyEvents, evaluated without branches:
+    // states and water levels differ from slot to slot, so branching on
+    // them mispredicts on most plants
+    static const uint8_t STATE_NOTIFIED_FLAG[static_cast<int>(PlantStateId::COUNT)] = {
+        0, 0, FLAG_RIPE_NOTIFIED, FLAG_DECAYING_NOTIFIED, FLAG_DEAD_NOTIFIED  // By PlantStateId
+    };
+    uint8_t slotFlags = flags[slot];
+    bool stateEvent = (STATE_NOTIFIED_FLAG[stateId[slot]] & ~slotFlags) != 0;
+    bool waterEvent = !(slotFlags & FLAG_NEEDS_WATER_NOTIFIED) & handles[slot].needsWater();
+    return stateEvent | waterEvent;
+}
+
+Plant* PlantStore::get(int slot) const {
+    if (slot < 0 || slot >= capacity || !isOccupied(slot)) {
+        return nullptr;
+    }
+    return &handles[slot];
+}
+
+// ============================================
+// OBSERVER PATTERN: Store-wide observers
+// ============================================
+
+void PlantStore::attachAll(Observer* observer) {
+    broadcast.attach(observer);
+}
+
+void PlantStore::detachAll(Observer* observer) {
+    broadcast.detach(observer);
+}
+
+void PlantStore::dispatchEvent(int slot, PlantEventType type) {
+    broadcast.setPlant(&handles[slot]);
+    broadcast.dispatchEvent(type);
+    
+    if (subjects[slot] != nullptr) {
+        subjects[slot]->dispatchEvent(type);
+    }
+}
+
+void PlantStore::countByState(int* counts) const {
+    std::fill(counts, counts + static_cast<int>(PlantStateId::COUNT), 0);
+    for (int slot = 0; slot < capacity; slot++) {
+        if (isOccupied(slot)) {
+            counts[stateId[slot]]++;
+        }
+    }
+}
+
+size_t PlantStore::getBytesPerSlot() {
+    return sizeof(float) * 5 + sizeof(int) + sizeof(uint8_t) * 4 +         // Hot data
+           sizeof(int) + sizeof(int16_t) * 2 + sizeof(double) +              // Cold data
+           sizeof(PlantSubject*) + sizeof(Plant);                            // Observers + handle
+}
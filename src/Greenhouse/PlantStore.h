@@ -0,0 +1,122 @@
+#ifndef PLANTSTORE_H
+#define PLANTSTORE_H
+
+#include <vector>
+#include <cstdint>
+#include "PlantTypes.h"
+#include "Patterns/Observer/PlantSubject.h"
+
+// Forward declarations
+class Plant;
+class Observer;
+
+// Raw saved fields of one plant (no strings), copied when a snapshot is
+// taken and turned into PlantData later, possibly over several frames
+struct PlantRecord {
+    int id;
+    int16_t posX;
+    int16_t posY;
+    uint8_t plantType;   // PlantType
+    uint8_t stateId;     // PlantStateId
+    float growthProgress;
+    int waterLevel;
+    double lastWateredTime;
+};
+
+// ============================================
+// PLANT STORE (Structure of Arrays)
+// ============================================
+// Owns the data of every plant in a greenhouse, one slot per tile.
+// Fields the update loop touches live in parallel arrays so a pass over
+// many plants streams through contiguous memory; states, growth cycles
+// and plant types are stored as small ids into shared flyweights.
+// Plant objects are thin handles (store + slot) with stable addresses.
+class PlantStore {
+    friend class Plant;
+    
+private:
+    // Notification flags (prevent spam)
+    enum Flags : uint8_t {
+        FLAG_OCCUPIED             = 1 << 0,
+        FLAG_NEEDS_WATER_NOTIFIED = 1 << 1,
+        FLAG_RIPE_NOTIFIED        = 1 << 2,
+        FLAG_DECAYING_NOTIFIED    = 1 << 3,
+        FLAG_DEAD_NOTIFIED        = 1 << 4
+    };
+    
+    int capacity;
+    int count;
+    double currentMinutes;    // Simulation timestamp for this tick (game minutes)
+    
+    // ============================================
+    // HOT DATA: Read/written on every plant update
+    // ============================================
+    std::vector<float> growthProgress;   // 0-100%
+    std::vector<int> waterLevel;         // 0-100%
+    std::vector<float> waterDeficit;     // Fractional depletion not yet applied
+    std::vector<float> decayTimer;       // Minutes in current state
+    std::vector<float> growthModifier;
+    std::vector<float> pendingGrowth;
+    std::vector<uint8_t> stateId;        // PlantStateId
+    std::vector<uint8_t> cycleId;        // Index into shared growth cycles
+    std::vector<uint8_t> plantType;      // PlantType
+    std::vector<uint8_t> flags;
+    
+    // ============================================
+    // COLD DATA: Identity, saves and observers
+    // ============================================
+    std::vector<int> ids;
+    std::vector<int16_t> posX;
+    std::vector<int16_t> posY;
+    std::vector<double> lastWateredTime;  // Game minutes
+    std::vector<PlantSubject*> subjects;  // Per-plant observers, created on first attach
+    
+    Plant* handles;           // One stable handle per slot
+    PlantSubject broadcast;   // Store-wide observers, retargeted per event
+    
+    void advanceChunk(const int* slots, const float* deltaTimes, int count);
+    bool hasPendingEvents(int slot) const;  // Would notifyEvents() fire anything?
+    
+public:
+    explicit PlantStore(int slotCount);
+    ~PlantStore();
+    
+    // Delete copy constructor and assignment
+    PlantStore(const PlantStore&) = delete;
+    PlantStore& operator=(const PlantStore&) = delete;
+    
+    // Initialise a slot as a fresh seed and return its handle
+    Plant* create(int slot, int plantId, PlantType type, int x, int y);
+    void remove(int slot);
+    void clear();
+    
+    // Advance many plants at once (distinct occupied slots, game minutes each).
+    // Arithmetic runs through PlantKernel grouped by state and growth
+    // cycle; transitions and events then follow slot order, matching
+    // Plant::update one by one. Runs in cache-sized chunks.
+    void advance(const int* slots, const float* deltaTimes, int count);
+    
+    Plant* get(int slot) const;  // nullptr if the slot is empty
+    bool isOccupied(int slot) const { return (flags[slot] & FLAG_OCCUPIED) != 0; }
+    int getCapacity() const { return capacity; }
+    int getCount() const { return count; }
+    
+    // Occupied slots per PlantStateId (counts has PlantStateId::COUNT entries)
+    void countByState(int* counts) const;
+    
+    // Set once per tick; plants read it instead of the wall clock
+    void setCurrentMinutes(double gameMinutes) { currentMinutes = gameMinutes; }
+    double getCurrentMinutes() const { return currentMinutes; }
+    
+    // Observers attached here receive events from every plant in the store
+    void attachAll(Observer* observer);
+    void detachAll(Observer* observer);
+    
+    // Deliver an event for one slot to store-wide and per-plant observers
+    void dispatchEvent(int slot, PlantEventType type);
+    
+    // Bytes of plant data per slot (excluding per-plant observer lists)
+    static size_t getBytesPerSlot();
+};
+
+#endif // PLANTSTORE_H
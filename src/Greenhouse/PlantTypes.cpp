@@ -1,31 +1,20 @@
 #include "PlantTypes.h"
-#include <algorithm>
-#include <random>
+#include "Core/Logger.h"
+#include "Core/Random.h"
+#include <chrono>
+#include <filesystem>
+#include <iterator>
 #include <stdexcept>
 
-PlantTypeDatabase* PlantTypeDatabase::instance = nullptr;
-
-PlantTypeDatabase::PlantTypeDatabase() {
-    initializePlantData();
-}
+// ============================================
+// BUILT-IN CATALOG: One entry per named PlantType, in enum order
+// ============================================
 
-PlantTypeDatabase* PlantTypeDatabase::getInstance() {
-    if (instance == nullptr) {
-        instance = new PlantTypeDatabase();
-    }
-    return instance;
-}
-
-void PlantTypeDatabase::destroyInstance() {
-    if (instance != nullptr) {
-        delete instance;
-        instance = nullptr;
-    }
-}
+namespace {
 
-void PlantTypeDatabase::initializePlantData() {
+const PlantTypeInfo BUILTIN_SPECIES[PLANT_TYPE_COUNT] = {
     // TIER 1: BEGINNER PLANTS
-    plantData[PlantType::BASIL] = {
+    {
         PlantType::BASIL, "Basil", PlantTier::BEGINNER,
         48,    // 2 days growth
         6,     // Water every 6 hours
@@ -34,9 +23,9 @@ void PlantTypeDatabase::initializePlantData() {
         120,   // 2 hour grace period
         0.1f,  // Slow decay
         20.0f  // 20% demand
-    };
+    },
     
-    plantData[PlantType::LETTUCE] = {
+    {
         PlantType::LETTUCE, "Lettuce", PlantTier::BEGINNER,
         60,    // 2.5 days
         5,     // Water every 5 hours
@@ -45,9 +34,9 @@ void PlantTypeDatabase::initializePlantData() {
         120,   // 2 hour grace
         0.12f, // Slow decay
         18.0f  // 18% demand
-    };
+    },
     
-    plantData[PlantType::TOMATO] = {
+    {
         PlantType::TOMATO, "Tomato", PlantTier::BEGINNER,
         72,    // 3 days
         8,     // Water every 8 hours
@@ -56,10 +45,10 @@ void PlantTypeDatabase::initializePlantData() {
         120,   // 2 hour grace
         0.15f, // Slow decay
         17.0f  // 17% demand
-    };
+    },
     
     // TIER 2: INTERMEDIATE PLANTS
-    plantData[PlantType::CARROT] = {
+    {
         PlantType::CARROT, "Carrot", PlantTier::INTERMEDIATE,
         96,    // 4 days
         7,     // Water every 7 hours
@@ -68,9 +57,9 @@ void PlantTypeDatabase::initializePlantData() {
         60,    // 1 hour grace
         0.2f,  // Medium decay
         15.0f  // 15% demand
-    };
+    },
     
-    plantData[PlantType::ROSE] = {
+    {
         PlantType::ROSE, "Rose", PlantTier::INTERMEDIATE,
         120,   // 5 days
         10,    // Water every 10 hours
@@ -79,9 +68,9 @@ void PlantTypeDatabase::initializePlantData() {
         60,    // 1 hour grace
         0.25f, // Medium decay
         12.0f  // 12% demand
-    };
+    },
     
-    plantData[PlantType::SUNFLOWER] = {
+    {
         PlantType::SUNFLOWER, "Sunflower", PlantTier::INTERMEDIATE,
         132,   // 5.5 days
         9,     // Water every 9 hours
@@ -90,10 +79,10 @@ void PlantTypeDatabase::initializePlantData() {
         60,    // 1 hour grace
         0.22f, // Medium decay
         8.0f   // 8% demand
-    };
+    },
     
     // TIER 3: ADVANCED PLANTS
-    plantData[PlantType::TULIP] = {
+    {
         PlantType::TULIP, "Tulip", PlantTier::ADVANCED,
         144,   // 6 days
         6,     // Water every 6 hours (high maintenance!)
@@ -102,9 +91,9 @@ void PlantTypeDatabase::initializePlantData() {
         30,    // 30 min grace
         0.4f,  // Fast decay
         5.0f   // 5% demand
-    };
+    },
     
-    plantData[PlantType::ORCHID] = {
+    {
         PlantType::ORCHID, "Orchid", PlantTier::ADVANCED,
         168,   // 7 days
         5,     // Water every 5 hours (very high maintenance!)
@@ -113,9 +102,9 @@ void PlantTypeDatabase::initializePlantData() {
         15,    // 15 min grace
         0.5f,  // Very fast decay
         3.0f   // 3% demand
-    };
+    },
     
-    plantData[PlantType::BONSAI] = {
+    {
         PlantType::BONSAI, "Bonsai", PlantTier::ADVANCED,
         192,   // 8 days
         8,     // Water every 8 hours (but needs pruning)
@@ -124,9 +113,9 @@ void PlantTypeDatabase::initializePlantData() {
         30,    // 30 min grace
         0.45f, // Fast decay
         1.5f   // 1.5% demand
-    };
+    },
     
-    plantData[PlantType::CACTUS] = {
+    {
         PlantType::CACTUS, "Rare Cactus", PlantTier::ADVANCED,
         240,   // 10 days
         20,    // Water every 20 hours (long intervals but MUST be precise!)
@@ -135,24 +124,192 @@ void PlantTypeDatabase::initializePlantData() {
         10,    // 10 min grace (very unforgiving!)
         0.6f,  // Extremely fast decay if timing is wrong
         0.5f   // 0.5% demand (very rare)
-    };
+    }
+};
+
+// Used until a catalog file is loaded, and never freed
+const PlantCatalog builtinCatalog(std::vector<PlantTypeInfo>(std::begin(BUILTIN_SPECIES), std::end(BUILTIN_SPECIES)));
+
+// Modification time of a catalog file (0 if missing)
+long long fileStamp(const std::string& path) {
+    std::error_code error;
+    std::filesystem::file_time_type time = std::filesystem::last_write_time(path, error);
+    return error ? 0 : static_cast<long long>(time.time_since_epoch().count());
+}
+
+} // namespace
+
+// ============================================
+// Singleton
+// ============================================
+PlantTypeDatabase* PlantTypeDatabase::instance = nullptr;
+std::atomic<const PlantCatalog*> PlantTypeDatabase::current(&builtinCatalog);
+std::atomic<uint64_t> PlantTypeDatabase::generation(0);
+
+PlantTypeDatabase::PlantTypeDatabase()
+    : hasRetired(false), catalogStamp(0), watching(false) {
+}
+
+PlantTypeDatabase::~PlantTypeDatabase() {
+    stopWatching();
+    
+    // Back to the built-in catalog; nothing may read a loaded one after this
+    const PlantCatalog* loaded = current.exchange(&builtinCatalog, std::memory_order_acq_rel);
+    if (loaded != &builtinCatalog) {
+        delete loaded;
+    }
+    reclaimRetired();
+}
+
+PlantTypeDatabase* PlantTypeDatabase::getInstance() {
+    if (instance == nullptr) {
+        instance = new PlantTypeDatabase();
+    }
+    return instance;
+}
+
+void PlantTypeDatabase::destroyInstance() {
+    if (instance != nullptr) {
+        delete instance;
+        instance = nullptr;
+    }
+}
+
+// ============================================
+// LOADING AND HOT RELOAD
+// ============================================
+
+void PlantTypeDatabase::publish(const PlantCatalog* next) {
+    const PlantCatalog* previous = current.exchange(next, std::memory_order_acq_rel);
+    generation.fetch_add(1, std::memory_order_acq_rel);
+    if (previous != &builtinCatalog) {
+        retired.push_back(previous);
+        hasRetired.store(true, std::memory_order_release);
+    }
 }
 
-const PlantTypeInfo& PlantTypeDatabase::getPlantInfo(PlantType type) const {
-    auto it = plantData.find(type);
-    if (it != plantData.end()) {
-        return it->second;
+bool PlantTypeDatabase::loadCatalog(const std::string& path) {
+    long long stamp = fileStamp(path);
+    std::vector<PlantTypeInfo> species;
+    std::string error;
+    if (!PlantCatalog::readFile(path, species, error)) {
+        LOG_ERROR(PLANT, "❌ Plant catalog " << path << ": " << error);
+        return false;
     }
-    throw std::runtime_error("Plant type not found in database");
+    
+    PlantCatalog* next = new PlantCatalog(std::move(species));
+    std::lock_guard<std::mutex> lock(catalogMutex);
+    publish(next);
+    catalogPath = path;
+    catalogStamp = stamp;
+    
+    LOG_INFO(PLANT, "🌱 Loaded plant catalog " << path << " (" << next->size() << " species)");
+    return true;
 }
 
-PlantType PlantTypeDatabase::getPlantTypeByName(const std::string& name) const {
-    for (const auto& pair : plantData) {
-        if (pair.second.name == name) {
-            return pair.first;
+bool PlantTypeDatabase::reloadCatalog() {
+    std::string path;
+    long long previousStamp;
+    {
+        std::lock_guard<std::mutex> lock(catalogMutex);
+        path = catalogPath;
+        previousStamp = catalogStamp;
+    }
+    if (path.empty()) {
+        return true;  // Built-in catalog
+    }
+    long long stamp = fileStamp(path);
+    if (stamp == previousStamp) {
+        return true;  // Unchanged
+    }
+    
+    // Parse outside the lock; readers never take it anyway
+    std::vector<PlantTypeInfo> species;
+    std::string error;
+    bool valid = PlantCatalog::readFile(path, species, error);
+    
+    std::lock_guard<std::mutex> lock(catalogMutex);
+    catalogStamp = stamp;  // Don't retry a rejected file until it changes again
+    
+    const PlantCatalog& old = catalog();
+    if (valid && static_cast<int>(species.size()) < old.size()) {
+        valid = false;
+        error = "species were removed";
+    }
+    for (int i = 0; valid && i < old.size(); i++) {
+        if (species[i].name != old.getEntries()[i].name) {
+            valid = false;
+            error = "row " + std::to_string(i + 1) + " was " + old.getEntries()[i].name;
         }
     }
-    throw std::runtime_error("Plant name not found: " + name);
+    if (!valid) {
+        LOG_WARN(PLANT, "⚠️  Plant catalog reload rejected, keeping the current one: " << error);
+        return false;
+    }
+    
+    publish(new PlantCatalog(std::move(species)));
+    LOG_INFO(PLANT, "🌱 Reloaded plant catalog " << path << " (" << getPlantTypeCount() << " species)");
+    return true;
+}
+
+bool PlantTypeDatabase::saveCatalog(const std::string& path, bool binary) const {
+    return binary ? catalog().writeBinary(path) : catalog().writeText(path);
+}
+
+void PlantTypeDatabase::reclaimRetired() {
+    if (!hasRetired.load(std::memory_order_acquire)) {
+        return;
+    }
+    
+    std::lock_guard<std::mutex> lock(catalogMutex);
+    for (const PlantCatalog* version : retired) {
+        delete version;
+    }
+    retired.clear();
+    hasRetired.store(false, std::memory_order_relaxed);
+}
+
+void PlantTypeDatabase::startWatching(double intervalSeconds) {
+    stopWatching();
+    watching.store(true);
+    watchThread = std::thread(&PlantTypeDatabase::watchLoop, this, intervalSeconds);
+}
+
+void PlantTypeDatabase::stopWatching() {
+    {
+        std::lock_guard<std::mutex> lock(watchMutex);
+        watching.store(false);
+    }
+    watchSignal.notify_all();
+    if (watchThread.joinable()) {
+        watchThread.join();
+    }
+}
+
+void PlantTypeDatabase::watchLoop(double intervalSeconds) {
+    std::chrono::duration<double> interval(intervalSeconds);
+    std::unique_lock<std::mutex> lock(watchMutex);
+    while (!watchSignal.wait_for(lock, interval, [this]() { return !watching.load(); })) {
+        lock.unlock();
+        reloadCatalog();
+        lock.lock();
+    }
+}
+
+// ============================================
+// LOOKUPS
+// ============================================
+
+PlantType PlantTypeDatabase::getPlantTypeByName(std::string_view name) const {
+    PlantType type;
+    if (!findPlantTypeByName(name, type)) {
+        throw std::runtime_error("Plant name not found: " + std::string(name));
+    }
+    return type;
+}
+
+bool PlantTypeDatabase::findPlantTypeByName(std::string_view name, PlantType& type) const {
+    return catalog().findByName(name, type);
 }
 
 std::string PlantTypeDatabase::getPlantName(PlantType type) const {
@@ -161,29 +318,27 @@ std::string PlantTypeDatabase::getPlantName(PlantType type) const {
 
 std::vector<PlantType> PlantTypeDatabase::getPlantsByTier(PlantTier tier) const {
     std::vector<PlantType> result;
-    for (const auto& pair : plantData) {
-        if (pair.second.tier == tier) {
-            result.push_back(pair.first);
+    for (const PlantTypeInfo& entry : catalog().getEntries()) {
+        if (entry.tier == tier) {
+            result.push_back(entry.type);
         }
     }
     return result;
 }
 
+// ============================================
+// DEMAND SAMPLING
+// ============================================
+
 PlantType PlantTypeDatabase::getRandomPlantByDemand() const {
-    // Create weighted distribution based on demand probability
-    std::vector<PlantType> types;
-    std::vector<float> weights;
-    
-    for (const auto& pair : plantData) {
-        types.push_back(pair.first);
-        weights.push_back(pair.second.demandProbability);
+    int row = catalog().getDemandSampler().sample(RandomService::stream(RandomStreamId::PLANTS));
+    return static_cast<PlantType>(row);
+}
+
+void PlantTypeDatabase::getRandomPlantsByDemand(PlantType* out, int count) const {
+    const AliasTable& sampler = catalog().getDemandSampler();
+    RandomStream& random = RandomService::stream(RandomStreamId::PLANTS);
+    for (int i = 0; i < count; i++) {
+        out[i] = static_cast<PlantType>(sampler.sample(random));
     }
-    
-    // Random selection
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    std::discrete_distribution<> dist(weights.begin(), weights.end());
-    
-    int index = dist(gen);
-    return types[index];
-}
\ No newline at end of file
+}
@@ -1,12 +1,21 @@
 #ifndef PLANTTYPES_H
 #define PLANTTYPES_H
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
 #include <string>
-#include <map>
-#include <vector> 
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "Core/AliasTable.h"
 
 
 // Enum for plant types
+// A PlantType is a row in the current catalog. The named values are the
+// rows of the built-in catalog; a catalog loaded from a file may define
+// its own species (up to MAX_PLANT_TYPES), numbered by row.
 enum class PlantType {
     BASIL,
     LETTUCE,
@@ -17,9 +26,13 @@ enum class PlantType {
     TULIP,
     ORCHID,
     BONSAI,
-    CACTUS
+    CACTUS,
+    COUNT
 };
 
+constexpr int PLANT_TYPE_COUNT = static_cast<int>(PlantType::COUNT);  // Built-in species
+constexpr int MAX_PLANT_TYPES = 256;  // PlantStore keeps the type in a byte
+
 // Plant tier/difficulty
 enum class PlantTier {
     BEGINNER,      // Easy & cheap
@@ -32,45 +45,154 @@ struct PlantTypeInfo {
     PlantType type;
     std::string name;
     PlantTier tier;
-    
+
     // Growth
     int growthTimeHours;      // Hours to grow from seed to ripe
     int waterIntervalHours;   // Hours between watering
-    
+
     // Economy
     int seedCost;
     int sellPrice;
-    
+
     // Maintenance
     int waterGracePeriodMinutes;  // Grace period for watering
     float decayRate;              // How fast it decays if neglected (0.0 - 1.0)
-    
+
     // Customer demand (probability %)
     float demandProbability;
+
+    // Derived once when the catalog is built, for the update loop
+    float growthPerMinute = 0.0f;       // Growth % per game minute at modifier 1
+    float depletionPerHour = 0.0f;      // Water % lost per game hour
+    double waterIntervalMinutes = 0.0;
+};
+
+// ============================================
+// PLANT CATALOG
+// ============================================
+// One immutable version of the species list, indexed by PlantType, with
+// the lookups built over it. A version never changes once published;
+// reloading builds a new one.
+//
+// Files come in two forms, told apart by their first bytes:
+// - text (authoring): one species per line,
+//     name, tier, growthHours, waterHours, seedCost, sellPrice, graceMinutes, decayRate, demand
+//   with tier one of beginner/intermediate/advanced; '#' starts a comment
+// - binary: a fixed header and fixed-size records, memory-mapped on load
+class PlantCatalog {
+private:
+    std::vector<PlantTypeInfo> entries;
+
+    AliasTable demandSampler;  // Over demandProbability
+
+    // Name -> type, hash and displace: the name's hash picks a bucket, the
+    // bucket's displacement picks a slot no other name uses, so a lookup
+    // is one hash, two loads and one string compare
+    std::vector<uint16_t> nameDisplacement;  // Per bucket
+    std::vector<int16_t> nameSlots;          // Catalog row, or -1 (size is a power of two)
+
+    void buildNameIndex();
+
+public:
+    // species must pass validate(); types are assigned by row
+    explicit PlantCatalog(std::vector<PlantTypeInfo> species);
+
+    int size() const { return static_cast<int>(entries.size()); }
+
+    // type must be a row of this catalog; no bounds check
+    const PlantTypeInfo& info(PlantType type) const { return entries[static_cast<int>(type)]; }
+    const std::vector<PlantTypeInfo>& getEntries() const { return entries; }
+    const AliasTable& getDemandSampler() const { return demandSampler; }
+
+    bool findByName(std::string_view name, PlantType& type) const;
+
+    // Name index layout, for the bench self-check
+    int getNameSlotCount() const { return static_cast<int>(nameSlots.size()); }
+    int getNameBucket(std::string_view name) const;
+
+    // False with a reason in error if the file is unreadable or invalid
+    static bool readFile(const std::string& path, std::vector<PlantTypeInfo>& species, std::string& error);
+    static bool validate(const std::vector<PlantTypeInfo>& species, std::string& error);
+
+    bool writeBinary(const std::string& path) const;
+    bool writeText(const std::string& path) const;
 };
 
 // Flyweight Factory: Manages shared plant type data
+// The current catalog is published through an atomic pointer, so hot
+// callers use PlantTypeDatabase::info(type) (or take catalog() once per
+// batch) without going through the singleton or a lock. Reloads swap the
+// pointer RCU-style: readers that already hold the old version finish
+// with it, and it is freed at the next reclaimRetired(), which callers
+// make where no reader can still hold it (Simulation::step start).
 class PlantTypeDatabase {
 private:
     static PlantTypeDatabase* instance;
-    std::map<PlantType, PlantTypeInfo> plantData;
-    
+    static std::atomic<const PlantCatalog*> current;
+    static std::atomic<uint64_t> generation;  // Bumped on every publish
+
+    // Writers (load, reload, the watcher) and reclamation
+    std::mutex catalogMutex;
+    std::vector<const PlantCatalog*> retired;  // Replaced, maybe still being read
+    std::atomic<bool> hasRetired;
+    std::string catalogPath;   // File behind the current catalog ("" = built-in)
+    long long catalogStamp;    // Its modification time when loaded
+
+    // File watcher (hot reload)
+    std::thread watchThread;
+    std::atomic<bool> watching;
+    std::mutex watchMutex;
+    std::condition_variable watchSignal;
+
     PlantTypeDatabase();
-    void initializePlantData();
+    ~PlantTypeDatabase();
+
+    void publish(const PlantCatalog* next);  // Caller holds catalogMutex
+    void watchLoop(double intervalSeconds);
 
 public:
     static PlantTypeDatabase* getInstance();
     static void destroyInstance();
-    
-    const PlantTypeInfo& getPlantInfo(PlantType type) const;
-    PlantType getPlantTypeByName(const std::string& name) const;
+
+    // Delete copy constructor and assignment
+    PlantTypeDatabase(const PlantTypeDatabase&) = delete;
+    PlantTypeDatabase& operator=(const PlantTypeDatabase&) = delete;
+
+    // The current version; valid until the next reclaimRetired()
+    static const PlantCatalog& catalog() { return *current.load(std::memory_order_acquire); }
+    static const PlantTypeInfo& info(PlantType type) { return catalog().info(type); }
+    static int getPlantTypeCount() { return catalog().size(); }
+    // Changes whenever a new version is published, so callers holding
+    // state derived from the rates (wake times) can tell they are stale
+    static uint64_t getGeneration() { return generation.load(std::memory_order_acquire); }
+
+    // Replace the species list (before any plants exist)
+    bool loadCatalog(const std::string& path);
+    // Re-read the loaded file if it changed; existing rows must keep their
+    // names so planted types stay valid (parameters may change, new
+    // species may be appended). False if the new file was rejected.
+    bool reloadCatalog();
+    bool saveCatalog(const std::string& path, bool binary) const;
+    const std::string& getCatalogPath() const { return catalogPath; }
+
+    // Poll the loaded file from a background thread and reload on change
+    void startWatching(double intervalSeconds);
+    void stopWatching();
+
+    // Free replaced versions; only where no reader holds a catalog reference
+    void reclaimRetired();
+
+    const PlantTypeInfo& getPlantInfo(PlantType type) const { return info(type); }
+    PlantType getPlantTypeByName(std::string_view name) const;  // Throws if unknown
+    bool findPlantTypeByName(std::string_view name, PlantType& type) const;
     std::string getPlantName(PlantType type) const;
-    
+
     // Get all plants by tier
     std::vector<PlantType> getPlantsByTier(PlantTier tier) const;
-    
-    // Random plant selection (weighted by demand)
+
+    // Random plant selection (weighted by demand), O(1) per pick
     PlantType getRandomPlantByDemand() const;
+    void getRandomPlantsByDemand(PlantType* out, int count) const;  // count picks in one go
 };
 
-#endif // PLANTTYPES_H
\ No newline at end of file
+#endif // PLANTTYPES_H
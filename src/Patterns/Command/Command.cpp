@@ -1,5 +1,7 @@
 #include "Command.h"
-#include <iostream>
+#include "Core/Logger.h"
+#include "Core/Tracer.h"
+#include "Greenhouse/Plant.h"
 
 // Forward declare what we need to avoid circular dependencies
 class Worker;
@@ -8,22 +10,45 @@ class Plant;
 // We'll implement the commands here without including Worker.h yet
 // The includes will be at the bottom or we use forward declarations
 
+// ============================================
+// Command tracing
+// ============================================
+Command::~Command() {
+    // Executed, cleared or discarded: the task's life ends here
+    Tracer::getInstance()->async(TracePhase::ASYNC_END, traceName, "task", traceId);
+}
+
+void Command::beginTrace(const char* name) {
+    traceId = Tracer::getInstance()->newAsyncId();
+    traceName = name;
+    Tracer::getInstance()->async(TracePhase::ASYNC_BEGIN, traceName, "task", traceId);
+}
+
 // ============================================
 // WaterPlantCommand Implementation
 // ============================================
 WaterPlantCommand::WaterPlantCommand(Worker* worker, Plant* plant)
-    : Command(worker), targetPlant(plant) {
+    : Command(worker), targetPlant(plant),
+      plantId(plant != nullptr ? plant->getId() : -1),
+      requestedAt(plant != nullptr ? plant->getCurrentMinutes() : 0.0) {
 }
 
 void WaterPlantCommand::execute() {
     if (targetPlant == nullptr || executor == nullptr) {
-        std::cout << "Cannot execute WaterPlantCommand: null pointer" << std::endl;
+        LOG_WARN(STAFF, "Cannot execute WaterPlantCommand: null pointer");
         return;
     }
     
     // Note: Actual implementation will be in Worker class methods
     // For now, just log
-    std::cout << "WaterPlantCommand executed" << std::endl;
+    LOG_DEBUG(STAFF, "WaterPlantCommand executed");
+}
+
+bool WaterPlantCommand::isStale() const {
+    return targetPlant != nullptr &&
+           (!targetPlant->isPlanted() || targetPlant->getId() != plantId ||
+            targetPlant->getStateId() == PlantStateId::DEAD ||
+            targetPlant->getLastWateredTime() >= requestedAt);
 }
 
 std::string WaterPlantCommand::getDescription() const {
@@ -34,16 +59,21 @@ std::string WaterPlantCommand::getDescription() const {
 // HarvestPlantCommand Implementation
 // ============================================
 HarvestPlantCommand::HarvestPlantCommand(Worker* worker, Plant* plant)
-    : Command(worker), targetPlant(plant) {
+    : Command(worker), targetPlant(plant), plantId(plant != nullptr ? plant->getId() : -1) {
 }
 
 void HarvestPlantCommand::execute() {
     if (targetPlant == nullptr || executor == nullptr) {
-        std::cout << "Cannot execute HarvestPlantCommand: null pointer" << std::endl;
+        LOG_WARN(STAFF, "Cannot execute HarvestPlantCommand: null pointer");
         return;
     }
     
-    std::cout << "HarvestPlantCommand executed" << std::endl;
+    LOG_DEBUG(STAFF, "HarvestPlantCommand executed");
+}
+
+bool HarvestPlantCommand::isStale() const {
+    return targetPlant != nullptr &&
+           (!targetPlant->isPlanted() || targetPlant->getId() != plantId || !targetPlant->canHarvest());
 }
 
 std::string HarvestPlantCommand::getDescription() const {
@@ -59,11 +89,11 @@ ServeCustomerCommand::ServeCustomerCommand(Worker* worker, int custId)
 
 void ServeCustomerCommand::execute() {
     if (executor == nullptr) {
-        std::cout << "Cannot execute ServeCustomerCommand: null executor" << std::endl;
+        LOG_WARN(STAFF, "Cannot execute ServeCustomerCommand: null executor");
         return;
     }
     
-    std::cout << "ServeCustomerCommand executed for customer #" << customerId << std::endl;
+    LOG_DEBUG(STAFF, "ServeCustomerCommand executed for customer #" << customerId);
 }
 
 std::string ServeCustomerCommand::getDescription() const {
@@ -79,11 +109,11 @@ PatrolCommand::PatrolCommand(Worker* worker, int zone)
 
 void PatrolCommand::execute() {
     if (executor == nullptr) {
-        std::cout << "Cannot execute PatrolCommand: null executor" << std::endl;
+        LOG_WARN(STAFF, "Cannot execute PatrolCommand: null executor");
         return;
     }
     
-    std::cout << "PatrolCommand executed for zone " << zoneId << std::endl;
+    LOG_DEBUG(STAFF, "PatrolCommand executed for zone " << zoneId);
 }
 
 std::string PatrolCommand::getDescription() const {
@@ -99,11 +129,11 @@ RestCommand::RestCommand(Worker* worker, float durationMinutes)
 
 void RestCommand::execute() {
     if (executor == nullptr) {
-        std::cout << "Cannot execute RestCommand: null executor" << std::endl;
+        LOG_WARN(STAFF, "Cannot execute RestCommand: null executor");
         return;
     }
     
-    std::cout << "RestCommand executed - resting for " << duration << " minutes" << std::endl;
+    LOG_DEBUG(STAFF, "RestCommand executed - resting for " << duration << " minutes");
 }
 
 std::string RestCommand::getDescription() const {
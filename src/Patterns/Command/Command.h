@@ -2,22 +2,36 @@
 #define COMMAND_H
 
 #include <string>
+#include <cstdint>
+#include "Core/LiveCount.h"
 
 // Forward declarations
 class Worker;
 class Plant;
 
 // Command Pattern: Abstract command interface
-class Command {
+class Command : public LiveCount<Command> {
 protected:
     Worker* executor;
     
+    // Trace span from creation to deletion (0 = not traced)
+    uint64_t traceId;
+    const char* traceName;
+    
 public:
-    Command(Worker* worker) : executor(worker) {}
-    virtual ~Command() = default;
+    Command(Worker* worker) : executor(worker), traceId(0), traceName(nullptr) {}
+    virtual ~Command();
+    
+    // Open this task's trace span; name must be a string literal
+    void beginTrace(const char* name);
+    uint64_t getTraceId() const { return traceId; }
     
     virtual void execute() = 0;
     virtual void undo() {}  // Optional undo functionality
+    
+    // True once the task no longer applies (its plant was harvested, died or
+    // was replaced, or the need was met by someone else); discarded unexecuted
+    virtual bool isStale() const { return false; }
     virtual std::string getDescription() const = 0;
 };
 
@@ -25,11 +39,14 @@ public:
 class WaterPlantCommand : public Command {
 private:
     Plant* targetPlant;
+    int plantId;             // Handles are reused when a slot is replanted
+    double requestedAt;      // Game minutes
     
 public:
     WaterPlantCommand(Worker* worker, Plant* plant);
     
     void execute() override;
+    bool isStale() const override;
     std::string getDescription() const override;
 };
 
@@ -37,11 +54,13 @@ public:
 class HarvestPlantCommand : public Command {
 private:
     Plant* targetPlant;
+    int plantId;
     
 public:
     HarvestPlantCommand(Worker* worker, Plant* plant);
     
     void execute() override;
+    bool isStale() const override;
     std::string getDescription() const override;
 };
 
@@ -1,5 +1,5 @@
 #include "StorageComponent.h"
-#include <iostream>
+#include "Core/Logger.h"
 #include <algorithm>
 
 // ============================================
@@ -31,8 +31,8 @@ int StorageSlot::getAvailableSpace() const {
 
 void StorageSlot::display(int depth) const {
     std::string indent(depth * 2, ' ');
-    std::cout << indent << "📦 " << name 
-              << " [" << currentLoad << "/" << capacity << "]" << std::endl;
+    LOG_INFO(STORAGE, indent << "📦 " << name 
+                      << " [" << currentLoad << "/" << capacity << "]");
 }
 
 // ============================================
@@ -113,8 +113,8 @@ int StorageContainer::getAvailableSpace() const {
 
 void StorageContainer::display(int depth) const {
     std::string indent(depth * 2, ' ');
-    std::cout << indent << "📁 " << name 
-              << " [" << currentLoad << "/" << capacity << "]" << std::endl;
+    LOG_INFO(STORAGE, indent << "📁 " << name 
+                      << " [" << currentLoad << "/" << capacity << "]");
     
     for (const auto* child : children) {
         child->display(depth + 1);
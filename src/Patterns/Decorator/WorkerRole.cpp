@@ -1,8 +1,8 @@
 #include "WorkerRole.h"
 #include "Staff/Worker.h"
 #include "Greenhouse/Plant.h"
-#include <iostream>
-#include <random>
+#include "Core/Logger.h"
+#include "Core/Random.h"
 
 // ============================================
 // WatererRole Implementation
@@ -39,9 +39,9 @@ void WatererRole::waterPlant(Plant* plant) {
     
     plant->water();
     
-    std::cout << worker->getName() << " watered " 
-              << plant->getPlantTypeInfo().name 
-              << " (took " << actualTime << "s)" << std::endl;
+    LOG_DEBUG(STAFF, worker->getName() << " watered " 
+                     << plant->getPlantTypeInfo().name 
+                     << " (took " << actualTime << "s)");
     
     // Gain experience
     worker->gainExperience(5);
@@ -87,16 +87,17 @@ void HarvesterRole::harvestPlant(Plant* plant) {
         int bonusValue = static_cast<int>(value * bonus);
         int totalValue = value + bonusValue;
         
-        std::cout << worker->getName() << " harvested " 
-                  << plant->getPlantTypeInfo().name 
-                  << " for $" << totalValue;
-        
         if (bonusValue > 0) {
-            std::cout << " (+" << bonusValue << " skill bonus)";
+            LOG_DEBUG(STAFF, worker->getName() << " harvested " 
+                             << plant->getPlantTypeInfo().name 
+                             << " for $" << totalValue
+                             << " (+" << bonusValue << " skill bonus)");
+        } else {
+            LOG_DEBUG(STAFF, worker->getName() << " harvested " 
+                             << plant->getPlantTypeInfo().name 
+                             << " for $" << totalValue);
         }
         
-        std::cout << std::endl;
-        
         // Gain experience
         worker->gainExperience(15);
     }
@@ -133,25 +134,21 @@ void CashierRole::serveCustomer() {
     customersServed++;
     
     // Chance for tip based on skill
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_real_distribution<> tipChance(0.0, 1.0);
+    RandomStream& random = RandomService::stream(RandomStreamId::WORKERS);
     
     int skillLevel = worker->getCashierSkill();
     float tipProbability = 0.1f * skillLevel;  // 10%, 20%, 30%, 40%, 50%
     
-    bool gotTip = tipChance(gen) < tipProbability;
-    
-    std::cout << worker->getName() << " served customer #" << customersServed;
+    bool gotTip = random.chance(tipProbability);
     
     if (gotTip) {
-        std::uniform_int_distribution<> tipAmount(5, 15);
-        int tip = tipAmount(gen);
-        std::cout << " (got $" << tip << " tip!)";
+        int tip = random.nextInt(5, 15);
+        LOG_DEBUG(STAFF, worker->getName() << " served customer #" << customersServed
+                         << " (got $" << tip << " tip!)");
+    } else {
+        LOG_DEBUG(STAFF, worker->getName() << " served customer #" << customersServed);
     }
     
-    std::cout << std::endl;
-    
     // Gain experience
     worker->gainExperience(8);
 }
@@ -189,16 +186,12 @@ bool SecurityRole::attemptStopRobber() {
     
     successRate *= alertLevel;  // Alert level bonus
     
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_real_distribution<> dist(0.0, 1.0);
-    
-    bool success = dist(gen) < successRate;
+    bool success = RandomService::stream(RandomStreamId::WORKERS).chance(successRate);
     
     if (success) {
         robbersStopped++;
-        std::cout << "🛡️  " << worker->getName() << " stopped a robber! (Total: " 
-                  << robbersStopped << ")" << std::endl;
+        LOG_INFO(STAFF, "🛡️  " << worker->getName() << " stopped a robber! (Total: " 
+                        << robbersStopped << ")");
         
         // Gain experience
         worker->gainExperience(25);
@@ -206,7 +199,7 @@ bool SecurityRole::attemptStopRobber() {
         // Reset alert level (relaxed after catching one)
         alertLevel = 1.0f;
     } else {
-        std::cout << "⚠️  Robber got past " << worker->getName() << "!" << std::endl;
+        LOG_WARN(STAFF, "⚠️  Robber got past " << worker->getName() << "!");
         
         // Increase alert for next time
         alertLevel += 0.5f;
@@ -3,8 +3,9 @@
 #include "Customer/VIPCustomer.h"
 #include "Customer/Robber.h"
 #include "Core/Config.h"
-#include <random>
-#include <iostream>
+#include "Core/Logger.h"
+#include "Core/Random.h"
+#include <algorithm>
 
 int CustomerFactory::nextCustomerId = 1;
 std::vector<std::string> CustomerFactory::nameList;
@@ -24,27 +25,53 @@ void CustomerFactory::initializeNames() {
 std::string CustomerFactory::getRandomName() {
     initializeNames();
     
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> dist(0, nameList.size() - 1);
-    
-    return nameList[dist(gen)];
+    RandomStream& random = RandomService::stream(RandomStreamId::CUSTOMERS);
+    return nameList[random.nextInt(0, static_cast<int>(nameList.size()) - 1)];
 }
 
-Customer* CustomerFactory::createRandomCustomer() {
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_real_distribution<> dist(0.0, 1.0);
-    
-    double roll = dist(gen);
+CustomerType CustomerFactory::rollCustomerType() {
+    double roll = RandomService::stream(RandomStreamId::CUSTOMERS).nextDouble();
     
     // 5% Robber, 10% VIP, 85% Regular
     if (roll < Config::ROBBER_CHANCE) {
-        return createRobber();
+        return CustomerType::ROBBER;
     } else if (roll < Config::ROBBER_CHANCE + Config::VIP_CHANCE) {
-        return createVIPCustomer();
-    } else {
-        return createRegularCustomer();
+        return CustomerType::VIP;
+    }
+    return CustomerType::REGULAR;
+}
+
+Customer* CustomerFactory::createRandomCustomer() {
+    switch (rollCustomerType()) {
+        case CustomerType::ROBBER: return createRobber();
+        case CustomerType::VIP:    return createVIPCustomer();
+        default:                   return createRegularCustomer();
+    }
+}
+
+void CustomerFactory::createRandomCustomers(Customer** out, int count) {
+    const int CHUNK = 64;  // Picks drawn per batch (stack buffers)
+    CustomerType types[CHUNK];
+    PlantType picks[CHUNK];
+    
+    for (int begin = 0; begin < count; begin += CHUNK) {
+        int end = std::min(count, begin + CHUNK);
+        int regulars = 0;
+        for (int i = begin; i < end; i++) {
+            types[i - begin] = rollCustomerType();
+            regulars += types[i - begin] == CustomerType::REGULAR ? 1 : 0;
+        }
+        
+        PlantTypeDatabase::getInstance()->getRandomPlantsByDemand(picks, regulars);
+        
+        int nextPick = 0;
+        for (int i = begin; i < end; i++) {
+            switch (types[i - begin]) {
+                case CustomerType::ROBBER: out[i] = createRobber(); break;
+                case CustomerType::VIP:    out[i] = createVIPCustomer(); break;
+                default:                   out[i] = createRegularCustomer(picks[nextPick++]); break;
+            }
+        }
     }
 }
 
@@ -52,7 +79,15 @@ Customer* CustomerFactory::createRegularCustomer() {
     std::string name = getRandomName();
     Customer* customer = new RegularCustomer(nextCustomerId++, name);
     
-    std::cout << "👤 Regular customer arrived: " << name << std::endl;
+    LOG_DEBUG(CUSTOMER, "👤 Regular customer arrived: " << name);
+    return customer;
+}
+
+Customer* CustomerFactory::createRegularCustomer(PlantType requested) {
+    std::string name = getRandomName();
+    Customer* customer = new RegularCustomer(nextCustomerId++, name, requested);
+    
+    LOG_DEBUG(CUSTOMER, "👤 Regular customer arrived: " << name);
     return customer;
 }
 
@@ -60,7 +95,7 @@ Customer* CustomerFactory::createVIPCustomer() {
     std::string name = getRandomName() + " (VIP)";
     Customer* customer = new VIPCustomer(nextCustomerId++, name);
     
-    std::cout << "⭐ VIP customer arrived: " << name << std::endl;
+    LOG_DEBUG(CUSTOMER, "⭐ VIP customer arrived: " << name);
     return customer;
 }
 
@@ -68,6 +103,6 @@ Customer* CustomerFactory::createRobber() {
     std::string name = "Suspicious Person";
     Customer* customer = new Robber(nextCustomerId++, name);
     
-    std::cout << "🚨 Suspicious person entered..." << std::endl;
+    LOG_DEBUG(CUSTOMER, "🚨 Suspicious person entered...");
     return customer;
 }
\ No newline at end of file
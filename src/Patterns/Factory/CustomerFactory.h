@@ -2,6 +2,7 @@
 #define CUSTOMERFACTORY_H
 
 #include "Customer/Customer.h"
+#include "Greenhouse/PlantTypes.h"
 #include <string>
 #include <vector>
 
@@ -13,13 +14,19 @@ private:
     
     static void initializeNames();
     static std::string getRandomName();
+    static CustomerType rollCustomerType();
     
 public:
     // Factory method: Creates customer based on probabilities
     static Customer* createRandomCustomer();
     
+    // Bulk arrivals: types are rolled first, then every regular customer's
+    // plant is drawn in one batch
+    static void createRandomCustomers(Customer** out, int count);
+    
     // Factory methods: Create specific customer types
     static Customer* createRegularCustomer();
+    static Customer* createRegularCustomer(PlantType requested);
     static Customer* createVIPCustomer();
     static Customer* createRobber();
     
@@ -2,11 +2,13 @@
 #include "Staff/Worker.h"
 #include "Greenhouse/Plant.h"
 #include "Patterns/Command/Command.h"
-#include <iostream>
+#include "Core/Logger.h"
+#include "Core/Tracer.h"
+#include "Core/FrameBudget.h"
 #include <algorithm>
 
 WorkScheduler::WorkScheduler() {
-    std::cout << "📋 WorkScheduler initialized" << std::endl;
+    LOG_INFO(STAFF, "📋 WorkScheduler initialized");
 }
 
 WorkScheduler::~WorkScheduler() {
@@ -17,7 +19,7 @@ WorkScheduler::~WorkScheduler() {
         delete cmd;
     }
     
-    std::cout << "📋 WorkScheduler destroyed" << std::endl;
+    LOG_INFO(STAFF, "📋 WorkScheduler destroyed");
 }
 
 // ============================================
@@ -26,54 +28,57 @@ WorkScheduler::~WorkScheduler() {
 
 void WorkScheduler::onPlantNeedsWater(Plant* plant) {
     if (plant == nullptr) {
-        std::cerr << "WorkScheduler::onPlantNeedsWater - null plant" << std::endl;
+        LOG_ERROR(STAFF, "WorkScheduler::onPlantNeedsWater - null plant");
         return;
     }
     
-    std::cout << "🚨 WorkScheduler observed: Plant needs water at (" 
-              << plant->getPosX() << ", " << plant->getPosY() << ")" << std::endl;
+    LOG_DEBUG(STAFF, "🚨 WorkScheduler observed: Plant needs water at (" 
+                     << plant->getPosX() << ", " << plant->getPosY() << ")");
     
     // Create water command and assign to appropriate worker
     Command* waterCmd = new WaterPlantCommand(nullptr, plant);
+    waterCmd->beginTrace("water");
     assignTask(waterCmd, "Waterer");
 }
 
 void WorkScheduler::onPlantRipe(Plant* plant) {
     if (plant == nullptr) {
-        std::cerr << "WorkScheduler::onPlantRipe - null plant" << std::endl;
+        LOG_ERROR(STAFF, "WorkScheduler::onPlantRipe - null plant");
         return;
     }
     
-    std::cout << "✅ WorkScheduler observed: Plant is ripe at (" 
-              << plant->getPosX() << ", " << plant->getPosY() << ")" << std::endl;
+    LOG_DEBUG(STAFF, "✅ WorkScheduler observed: Plant is ripe at (" 
+                     << plant->getPosX() << ", " << plant->getPosY() << ")");
     
     // Create harvest command and assign to appropriate worker
     Command* harvestCmd = new HarvestPlantCommand(nullptr, plant);
+    harvestCmd->beginTrace("harvest");
     assignTask(harvestCmd, "Harvester");
 }
 
 void WorkScheduler::onPlantDecaying(Plant* plant) {
     if (plant == nullptr) {
-        std::cerr << "WorkScheduler::onPlantDecaying - null plant" << std::endl;
+        LOG_ERROR(STAFF, "WorkScheduler::onPlantDecaying - null plant");
         return;
     }
     
-    std::cout << "⚠️  WorkScheduler observed: Plant is decaying at (" 
-              << plant->getPosX() << ", " << plant->getPosY() << ")" << std::endl;
+    LOG_DEBUG(STAFF, "⚠️  WorkScheduler observed: Plant is decaying at (" 
+                     << plant->getPosX() << ", " << plant->getPosY() << ")");
     
     // Urgent harvest command - decaying plants should be harvested immediately
     Command* harvestCmd = new HarvestPlantCommand(nullptr, plant);
+    harvestCmd->beginTrace("harvest decaying");
     assignTask(harvestCmd, "Harvester");
 }
 
 void WorkScheduler::onPlantDead(Plant* plant) {
     if (plant == nullptr) {
-        std::cerr << "WorkScheduler::onPlantDead - null plant" << std::endl;
+        LOG_ERROR(STAFF, "WorkScheduler::onPlantDead - null plant");
         return;
     }
     
-    std::cout << "💀 WorkScheduler observed: Plant died at (" 
-              << plant->getPosX() << ", " << plant->getPosY() << ")" << std::endl;
+    LOG_DEBUG(STAFF, "💀 WorkScheduler observed: Plant died at (" 
+                     << plant->getPosX() << ", " << plant->getPosY() << ")");
     
     // Dead plants need to be removed (could create a RemovePlantCommand)
     // For now, just log the event
@@ -85,13 +90,13 @@ void WorkScheduler::onPlantDead(Plant* plant) {
 
 void WorkScheduler::registerWorker(Worker* worker) {
     if (worker == nullptr) {
-        std::cerr << "WorkScheduler::registerWorker - null worker" << std::endl;
+        LOG_ERROR(STAFF, "WorkScheduler::registerWorker - null worker");
         return;
     }
     
     workers.push_back(worker);
-    std::cout << "📋 WorkScheduler: Registered worker '" << worker->getName() 
-              << "' (Total: " << workers.size() << ")" << std::endl;
+    LOG_INFO(STAFF, "📋 WorkScheduler: Registered worker '" << worker->getName() 
+                    << "' (Total: " << workers.size() << ")");
 }
 
 void WorkScheduler::unregisterWorker(Worker* worker) {
@@ -103,8 +108,8 @@ void WorkScheduler::unregisterWorker(Worker* worker) {
     if (it != workers.end()) {
         std::string name = (*it)->getName();
         workers.erase(it);
-        std::cout << "📋 WorkScheduler: Unregistered worker '" << name 
-                  << "' (Remaining: " << workers.size() << ")" << std::endl;
+        LOG_INFO(STAFF, "📋 WorkScheduler: Unregistered worker '" << name 
+                        << "' (Remaining: " << workers.size() << ")");
     }
 }
 
@@ -134,7 +139,7 @@ Worker* WorkScheduler::findAvailableWorker() {
 
 void WorkScheduler::assignTask(Command* task, const std::string& taskType) {
     if (task == nullptr) {
-        std::cerr << "WorkScheduler::assignTask - null task" << std::endl;
+        LOG_ERROR(STAFF, "WorkScheduler::assignTask - null task");
         return;
     }
     
@@ -143,19 +148,20 @@ void WorkScheduler::assignTask(Command* task, const std::string& taskType) {
     
     if (worker != nullptr) {
         worker->addTask(task);
-        std::cout << "📋 Task assigned to " << worker->getName() 
-                  << " (Role: " << taskType << ")" << std::endl;
+        LOG_DEBUG(STAFF, "📋 Task assigned to " << worker->getName() 
+                         << " (Role: " << taskType << ")");
     } else {
         // No suitable worker available, queue the task
         globalTaskQueue.push(task);
-        std::cout << "📋 Task queued (no available " << taskType 
-                  << ") - Queue size: " << globalTaskQueue.size() << std::endl;
+        Tracer::getInstance()->async(TracePhase::ASYNC_BEGIN, "queued", "task", task->getTraceId());
+        LOG_DEBUG(STAFF, "📋 Task queued (no available " << taskType 
+                         << ") - Queue size: " << globalTaskQueue.size());
     }
 }
 
 void WorkScheduler::distributeTaskToWorkers(Command* task) {
     if (task == nullptr) {
-        std::cerr << "WorkScheduler::distributeTaskToWorkers - null task" << std::endl;
+        LOG_ERROR(STAFF, "WorkScheduler::distributeTaskToWorkers - null task");
         return;
     }
     
@@ -164,15 +170,16 @@ void WorkScheduler::distributeTaskToWorkers(Command* task) {
     
     if (worker != nullptr) {
         worker->addTask(task);
-        std::cout << "📋 Task distributed to " << worker->getName() << std::endl;
+        LOG_DEBUG(STAFF, "📋 Task distributed to " << worker->getName());
     } else {
         // Queue if no worker available
         globalTaskQueue.push(task);
-        std::cout << "📋 Task queued - Queue size: " << globalTaskQueue.size() << std::endl;
+        Tracer::getInstance()->async(TracePhase::ASYNC_BEGIN, "queued", "task", task->getTraceId());
+        LOG_DEBUG(STAFF, "📋 Task queued - Queue size: " << globalTaskQueue.size());
     }
 }
 
-void WorkScheduler::processGlobalTasks() {
+void WorkScheduler::processGlobalTasks(const FrameBudget* budget) {
     if (globalTaskQueue.empty()) {
         return;
     }
@@ -191,14 +198,52 @@ void WorkScheduler::processGlobalTasks() {
         // Assign queued task to worker
         Command* task = globalTaskQueue.front();
         globalTaskQueue.pop();
+        Tracer::getInstance()->async(TracePhase::ASYNC_END, "queued", "task", task->getTraceId());
         worker->addTask(task);
         tasksProcessed++;
+        
+        // At least one task per call, so a backlog drains even when
+        // every frame is over budget
+        if (budget != nullptr && budget->isExhausted()) {
+            if (!globalTaskQueue.empty()) {
+                budget->noteDeferred();
+            }
+            break;
+        }
     }
     
     if (tasksProcessed > 0) {
-        std::cout << "📋 Processed " << tasksProcessed << " queued task(s). "
-                  << "Remaining: " << globalTaskQueue.size() << std::endl;
+        LOG_DEBUG(STAFF, "📋 Processed " << tasksProcessed << " queued task(s). "
+                         << "Remaining: " << globalTaskQueue.size());
+    }
+}
+
+int WorkScheduler::discardStaleTasks() {
+    int discarded = 0;
+    
+    std::queue<Command*> remaining;
+    while (!globalTaskQueue.empty()) {
+        Command* task = globalTaskQueue.front();
+        globalTaskQueue.pop();
+        if (task->isStale()) {
+            Tracer::getInstance()->async(TracePhase::ASYNC_END, "queued", "task", task->getTraceId());
+            delete task;
+            discarded++;
+        } else {
+            remaining.push(task);
+        }
+    }
+    globalTaskQueue.swap(remaining);
+    
+    for (auto* worker : workers) {
+        discarded += worker->discardStaleTasks();
+    }
+    
+    if (discarded > 0) {
+        LOG_DEBUG(STAFF, "📋 Discarded " << discarded << " stale task(s). "
+                         << "Queued: " << globalTaskQueue.size());
     }
+    return discarded;
 }
 
 // ============================================
@@ -242,14 +287,14 @@ std::vector<Worker*> WorkScheduler::getWorkersByRole(const std::string& role) {
 
 void WorkScheduler::payAllWorkers(double& balance) {
     if (workers.empty()) {
-        std::cout << "\n💰 No workers to pay" << std::endl;
+        LOG_INFO(STAFF, "\n💰 No workers to pay");
         return;
     }
     
-    std::cout << "\n╔════════════════════════════════════════╗" << std::endl;
-    std::cout << "║          DAILY PAYROLL                 ║" << std::endl;
-    std::cout << "╚════════════════════════════════════════╝" << std::endl;
-    std::cout << "Current Balance: $" << balance << std::endl;
+    LOG_INFO(STAFF, "\n╔════════════════════════════════════════╗");
+    LOG_INFO(STAFF, "║          DAILY PAYROLL                 ║");
+    LOG_INFO(STAFF, "╚════════════════════════════════════════╝");
+    LOG_INFO(STAFF, "Current Balance: $" << balance);
     
     double totalPaid = 0.0;
     int workersPaid = 0;
@@ -261,28 +306,28 @@ void WorkScheduler::payAllWorkers(double& balance) {
             balance -= salary;
             totalPaid += salary;
             workersPaid++;
-            std::cout << "  ✓ Paid " << worker->getName() 
-                      << " (Level " << worker->getOverallLevel() << ") - $" 
-                      << salary << std::endl;
+            LOG_INFO(STAFF, "  ✓ Paid " << worker->getName() 
+                            << " (Level " << worker->getOverallLevel() << ") - $" 
+                            << salary);
         } else {
-            std::cout << "  ✗ INSUFFICIENT FUNDS to pay " << worker->getName() 
-                      << " (Need $" << salary << ")" << std::endl;
+            LOG_WARN(STAFF, "  ✗ INSUFFICIENT FUNDS to pay " << worker->getName() 
+                            << " (Need $" << salary << ")");
         }
     }
     
-    std::cout << "\n─────────────────────────────────────────" << std::endl;
-    std::cout << "Workers Paid: " << workersPaid << "/" << workers.size() << std::endl;
-    std::cout << "Total Paid: $" << totalPaid << std::endl;
-    std::cout << "Remaining Balance: $" << balance << std::endl;
-    std::cout << "═════════════════════════════════════════\n" << std::endl;
+    LOG_INFO(STAFF, "\n─────────────────────────────────────────");
+    LOG_INFO(STAFF, "Workers Paid: " << workersPaid << "/" << workers.size());
+    LOG_INFO(STAFF, "Total Paid: $" << totalPaid);
+    LOG_INFO(STAFF, "Remaining Balance: $" << balance);
+    LOG_INFO(STAFF, "═════════════════════════════════════════\n");
 }
 
-void WorkScheduler::updateAllWorkers(float deltaTime) {
+void WorkScheduler::updateAllWorkers(float deltaTime, const FrameBudget* budget) {
     // Update each worker
     for (auto* worker : workers) {
         worker->update(deltaTime);
     }
     
     // Process any queued tasks if workers become available
-    processGlobalTasks();
+    processGlobalTasks(budget);
 }
\ No newline at end of file
@@ -10,6 +10,7 @@
 class Worker;
 class Plant;
 class Command;
+class FrameBudget;
 
 // ============================================
 // CONCRETE OBSERVER: WorkScheduler
@@ -47,16 +48,18 @@ public:
     // Task distribution
     void assignTask(Command* task, const std::string& taskType);
     void distributeTaskToWorkers(Command* task);
-    void processGlobalTasks();
+    void processGlobalTasks(const FrameBudget* budget = nullptr);  // Stops early once the budget runs out
+    int discardStaleTasks();  // Queued and assigned; returns the number dropped
     
     // Worker queries
     int getAvailableWorkerCount() const;
+    int getQueuedTaskCount() const { return static_cast<int>(globalTaskQueue.size()); }
     Worker* getWorkerById(int id);
     std::vector<Worker*> getWorkersByRole(const std::string& role);
     
     // Daily operations
     void payAllWorkers(double& balance);
-    void updateAllWorkers(float deltaTime);
+    void updateAllWorkers(float deltaTime, const FrameBudget* budget = nullptr);
 };
 
 #endif // WORKSCHEDULER_H
\ No newline at end of file
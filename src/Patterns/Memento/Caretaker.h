@@ -2,9 +2,9 @@
 #define CARETAKER_H
 
 #include "GameMemento.h"
+#include "Core/Logger.h"
 #include <vector>
 #include <string>
-#include <iostream>
 #include <stdexcept>
 
 // Caretaker Pattern: Manages memento history in memory
@@ -22,12 +22,12 @@ public:
         // Remove oldest if at capacity
         if (static_cast<int>(mementos.size()) >= maxSnapshots) {
             mementos.erase(mementos.begin());
-            std::cout << "🗑️  Oldest snapshot removed (max capacity)" << std::endl;
+            LOG_INFO(SAVE, "🗑️  Oldest snapshot removed (max capacity)");
         }
         
         mementos.push_back(memento);
-        std::cout << "💾 Snapshot saved: " << memento.getSaveName() 
-                  << " (" << mementos.size() << "/" << maxSnapshots << ")" << std::endl;
+        LOG_INFO(SAVE, "💾 Snapshot saved: " << memento.getSaveName() 
+                       << " (" << mementos.size() << "/" << maxSnapshots << ")");
     }
     
     // Get specific snapshot by index
@@ -55,8 +55,8 @@ public:
         GameMemento removed = mementos.back();
         mementos.pop_back();
         
-        std::cout << "⏪ Undoing: " << removed.getSaveName() << std::endl;
-        std::cout << "   Restoring: " << mementos.back().getSaveName() << std::endl;
+        LOG_INFO(SAVE, "⏪ Undoing: " << removed.getSaveName());
+        LOG_INFO(SAVE, "   Restoring: " << mementos.back().getSaveName());
         
         return mementos.back();
     }
@@ -67,30 +67,38 @@ public:
     bool canUndo() const { return mementos.size() > 1; }
     int getMaxSnapshots() const { return maxSnapshots; }
     
+    size_t getSnapshotBytes() const {
+        size_t bytes = 0;
+        for (const GameMemento& memento : mementos) {
+            bytes += memento.getState().getApproxBytes();
+        }
+        return bytes;
+    }
+    
     // Clear all snapshots
     void clear() {
         int count = mementos.size();
         mementos.clear();
-        std::cout << "🗑️  Cleared " << count << " snapshot(s)" << std::endl;
+        LOG_INFO(SAVE, "🗑️  Cleared " << count << " snapshot(s)");
     }
     
     // List all snapshots
     void listSnapshots() const {
         if (mementos.empty()) {
-            std::cout << "\n📋 No snapshots available" << std::endl;
+            LOG_INFO(SAVE, "\n📋 No snapshots available");
             return;
         }
         
-        std::cout << "\n╔════════════════════════════════════════╗" << std::endl;
-        std::cout << "║       AVAILABLE SNAPSHOTS              ║" << std::endl;
-        std::cout << "╚════════════════════════════════════════╝" << std::endl;
-        std::cout << "Total: " << mementos.size() << "/" << maxSnapshots << std::endl;
+        LOG_INFO(SAVE, "\n╔════════════════════════════════════════╗");
+        LOG_INFO(SAVE, "║       AVAILABLE SNAPSHOTS              ║");
+        LOG_INFO(SAVE, "╚════════════════════════════════════════╝");
+        LOG_INFO(SAVE, "Total: " << mementos.size() << "/" << maxSnapshots);
         
         for (size_t i = 0; i < mementos.size(); i++) {
             const GameMemento& m = mementos[i];
-            std::cout << "\n[" << i << "] " << m.getSaveName() << std::endl;
-            std::cout << "    Time: " << m.getTimestamp() << std::endl;
-            std::cout << "    Day " << m.getDay() << " | $" << m.getCurrency() << std::endl;
+            LOG_INFO(SAVE, "\n[" << i << "] " << m.getSaveName());
+            LOG_INFO(SAVE, "    Time: " << m.getTimestamp());
+            LOG_INFO(SAVE, "    Day " << m.getDay() << " | $" << m.getCurrency());
         }
     }
 };
@@ -2,17 +2,18 @@
 #define GAMEMEMENTO_H
 
 #include "Core/GameData.h"
+#include "Core/LiveCount.h"
 
 // Memento Pattern: Immutable snapshot of game state
-// Only the Originator (GameManager) can create mementos
-class GameMemento {
+// Only the Originator (Simulation) can create mementos
+class GameMemento : public LiveCount<GameMemento> {
 private:
     GameData state;
     
     // Private constructor - only friends can create
     GameMemento(const GameData& data) : state(data) {}
     
-    friend class GameManager;  // Originator can create mementos
+    friend class Simulation;  // Originator can create mementos
     
 public:
     // Read-only access to state (for Caretaker and restoration)
@@ -4,7 +4,7 @@
 #include "Observer.h"
 #include "Subject.h"
 #include "PlantSubject.h"
-#include <iostream>
+#include "Core/Logger.h"
 
 // Forward declaration
 class Plant;
@@ -23,23 +23,19 @@ public:
         // Safely cast subject to PlantSubject
         PlantSubject* plantSubject = dynamic_cast<PlantSubject*>(subject);
         if (plantSubject == nullptr) {
-            std::cerr << "Error: PlantObserver received update from non-PlantSubject" << std::endl;
+            LOG_ERROR(PLANT, "Error: PlantObserver received update from non-PlantSubject");
             return;
         }
         
         // Get event type and plant
-        std::string event = plantSubject->getEvent();
         Plant* plant = plantSubject->getPlant();
         
         // Dispatch to appropriate handler based on event
-        if (event == "NEEDS_WATER") {
-            onPlantNeedsWater(plant);
-        } else if (event == "RIPE") {
-            onPlantRipe(plant);
-        } else if (event == "DECAYING") {
-            onPlantDecaying(plant);
-        } else if (event == "DEAD") {
-            onPlantDead(plant);
+        switch (plantSubject->getEventType()) {
+            case PlantEventType::NEEDS_WATER: onPlantNeedsWater(plant); break;
+            case PlantEventType::RIPE:        onPlantRipe(plant);       break;
+            case PlantEventType::DECAYING:    onPlantDecaying(plant);   break;
+            case PlantEventType::DEAD:        onPlantDead(plant);       break;
         }
     }
     
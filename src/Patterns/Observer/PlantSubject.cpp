@@ -1,4 +1,13 @@
 #include "PlantSubject.h"
+#include "Greenhouse/Plant.h"
 
-// All implementation is in the header
-// This file exists only to satisfy the linker
\ No newline at end of file
+// Most of the implementation is in the header
+
+thread_local PlantEventBuffer* PlantEventBuffer::threadBuffer = nullptr;
+
+void PlantEventBuffer::dispatch() {
+    for (const PendingEvent& event : events) {
+        event.plant->dispatchEvent(event.type);
+    }
+    events.clear();
+}
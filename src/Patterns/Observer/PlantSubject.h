@@ -2,49 +2,105 @@
 #define PLANTSUBJECT_H
 
 #include "Subject.h"
+#include "Core/Tracer.h"
+#include "Core/LiveCount.h"
 #include <string>
+#include <vector>
 
 // Forward declaration
 class Plant;
 
+// Plant events observers can receive
+enum class PlantEventType {
+    NEEDS_WATER,
+    RIPE,
+    DECAYING,
+    DEAD
+};
+
 // ============================================
 // CONCRETE SUBJECT: PlantSubject
 // ============================================
 // Concrete subject that represents an observable plant
-class PlantSubject : public Subject {
+class PlantSubject : public Subject, public LiveCount<PlantSubject> {
 private:
     Plant* plant;              // The plant being observed
-    std::string currentEvent;  // Current event that triggered notification
+    PlantEventType currentEvent;  // Current event that triggered notification
     
 public:
-    explicit PlantSubject(Plant* p) : plant(p), currentEvent("") {}
+    explicit PlantSubject(Plant* p) : plant(p), currentEvent(PlantEventType::NEEDS_WATER) {}
     
     // Get the plant being observed
     Plant* getPlant() const { return plant; }
     
-    // Get current event type
-    std::string getEvent() const { return currentEvent; }
+    // Retarget a shared subject (PlantStore broadcasts for all its plants)
+    void setPlant(Plant* p) { plant = p; }
     
-    // Notify observers about specific plant events
-    void notifyNeedsWater() {
-        currentEvent = "NEEDS_WATER";
-        notify();  // Calls Subject::notify()
-    }
+    // Get current event type (observers switch on this)
+    PlantEventType getEventType() const { return currentEvent; }
     
-    void notifyRipe() {
-        currentEvent = "RIPE";
-        notify();
+    // Event name, for logging and display
+    std::string getEvent() const { return getEventName(currentEvent); }
+    
+    static const char* getEventName(PlantEventType type) {
+        switch (type) {
+            case PlantEventType::NEEDS_WATER: return "NEEDS_WATER";
+            case PlantEventType::RIPE:        return "RIPE";
+            case PlantEventType::DECAYING:    return "DECAYING";
+            case PlantEventType::DEAD:        return "DEAD";
+        }
+        return "";
     }
     
-    void notifyDecaying() {
-        currentEvent = "DECAYING";
-        notify();
+    // Deliver an event to observers
+    void dispatchEvent(PlantEventType type) {
+        Tracer::Scope scope(getEventName(type), "plant");
+        currentEvent = type;
+        notify();  // Calls Subject::notify()
     }
     
-    void notifyDead() {
-        currentEvent = "DEAD";
-        notify();
+    // Notify observers about specific plant events
+    void notifyNeedsWater() { dispatchEvent(PlantEventType::NEEDS_WATER); }
+    void notifyRipe()       { dispatchEvent(PlantEventType::RIPE); }
+    void notifyDecaying()   { dispatchEvent(PlantEventType::DECAYING); }
+    void notifyDead()       { dispatchEvent(PlantEventType::DEAD); }
+};
+
+// ============================================
+// PLANT EVENT BUFFER
+// ============================================
+// Events recorded during a parallel plant update. Each worker fills its
+// own buffer; dispatching the buffers in a fixed order delivers events
+// exactly as a serial update would have.
+class PlantEventBuffer {
+private:
+    struct PendingEvent {
+        Plant* plant;
+        PlantEventType type;
+    };
+    
+    std::vector<PendingEvent> events;
+    
+    // When set, plants raising events on this thread queue them here
+    static thread_local PlantEventBuffer* threadBuffer;
+    
+public:
+    // Route this thread's plant events into a buffer (nullptr = notify immediately).
+    // Lets plants update on worker threads while observers only ever run
+    // on the thread that dispatches the buffer.
+    static void setThreadBuffer(PlantEventBuffer* buffer) { threadBuffer = buffer; }
+    static PlantEventBuffer* getThreadBuffer() { return threadBuffer; }
+    
+    void push(Plant* plant, PlantEventType type) {
+        events.push_back({plant, type});
     }
+    
+    // Deliver recorded events in order, then empty the buffer
+    void dispatch();
+    
+    void clear() { events.clear(); }
+    size_t size() const { return events.size(); }
+    bool empty() const { return events.empty(); }
 };
 
 #endif // PLANTSUBJECT_H
\ No newline at end of file
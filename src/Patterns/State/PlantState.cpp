@@ -1,6 +1,51 @@
 #include "PlantState.h"
+#include "PlantStateMachine.h"
 #include "../../Greenhouse/Plant.h"
-#include <iostream>
+#include "Core/Logger.h"
+#include <limits>
+
+// ============================================
+// Shared state instances (Flyweight)
+// ============================================
+PlantState* PlantState::get(PlantStateId id) {
+    static SeedState seed;
+    static GrowingState growing;
+    static RipeState ripe;
+    static DecayingState decaying;
+    static DeadState dead;
+    static PlantState* const states[] = {&seed, &growing, &ripe, &decaying, &dead};
+    
+    return states[static_cast<int>(id)];
+}
+
+const char* PlantState::getName(PlantStateId id) {
+    static const char* const names[] = {"Seed", "Growing", "Ripe", "Decaying", "Dead"};
+    
+    return names[static_cast<int>(id)];
+}
+
+bool PlantState::getIdByName(std::string_view name, PlantStateId& id) {
+    for (int i = 0; i < static_cast<int>(PlantStateId::COUNT); i++) {
+        if (name == getName(static_cast<PlantStateId>(i))) {
+            id = static_cast<PlantStateId>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+void PlantState::checkTransition(Plant* plant) const {
+    PlantStateEvent event = PlantStateMachine::detect(getId(), plant->getGrowthProgress(), plant->getDecayTimer());
+    if (event == PlantStateEvent::NONE) {
+        return;
+    }
+    
+    // Neglected plants restart from nothing once revived
+    if (event == PlantStateEvent::NEGLECTED) {
+        plant->setGrowthProgress(0.0f);
+    }
+    plant->setState(PlantStateMachine::next(getId(), event));
+}
 
 // ============================================
 // SeedState Implementation
@@ -8,17 +53,18 @@
 void SeedState::update(Plant* plant, float deltaTime) {
     // Seeds just wait to germinate
     plant->addGrowthProgress(deltaTime);
-    
-    // Transition to Growing when germination complete (10% progress)
-    if (plant->getGrowthProgress() >= 10.0f) {
-        plant->setState(new GrowingState());
-        delete this;
-    }
+    checkTransition(plant);
 }
 
 void SeedState::water(Plant* plant) {
     plant->setWaterLevel(100);
-    plant->setLastWateredTime(std::time(nullptr));
+    plant->setLastWateredTime(plant->getCurrentMinutes());
+}
+
+float SeedState::getTimeUntilTransition(const Plant* plant) const {
+    // Germination: state adds 1% per minute on top of the growth cycle
+    float rate = 1.0f + plant->getCycleGrowthRate();
+    return (PlantStateMachine::GERMINATION_PROGRESS - plant->getGrowthProgress()) / rate;
 }
 
 // ============================================
@@ -39,24 +85,30 @@ void GrowingState::update(Plant* plant, float deltaTime) {
         plant->addGrowthProgress(deltaTime * -0.2f);
     }
     
-    // Transition to Ripe when fully grown
-    if (plant->getGrowthProgress() >= 100.0f) {
-        plant->setState(new RipeState());
-        delete this;
-    }
-    
-    // Transition to Decaying if severely neglected
-    if (plant->getGrowthProgress() < 0.0f) {
-        plant->setGrowthProgress(0.0f);
-        plant->setState(new DecayingState());
-        delete this;
-    }
+    checkTransition(plant);
 }
 
 void GrowingState::water(Plant* plant) {
     plant->setWaterLevel(100);
-    plant->setLastWateredTime(std::time(nullptr));
-    plant->notifyObservers("watered");
+    plant->setLastWateredTime(plant->getCurrentMinutes());
+}
+
+float GrowingState::getTimeUntilTransition(const Plant* plant) const {
+    // Mirror the water-dependent rates in update()
+    float stateRate;
+    if (plant->getWaterLevel() > 20) {
+        stateRate = 1.0f;
+    } else if (plant->getWaterLevel() > 0) {
+        stateRate = 0.5f;
+    } else {
+        stateRate = -0.2f;
+    }
+    
+    float rate = plant->getCycleGrowthRate() + stateRate;
+    if (rate <= 0.0f) {
+        return std::numeric_limits<float>::infinity();
+    }
+    return (PlantStateMachine::RIPE_PROGRESS - plant->getGrowthProgress()) / rate;
 }
 
 // ============================================
@@ -68,17 +120,16 @@ void RipeState::update(Plant* plant, float deltaTime) {
     
     // Ripe plants stay ripe but start decaying if not harvested
     plant->addDecayTimer(deltaTime);
-    
-    // After 24 hours ripe, start decaying
-    if (plant->getDecayTimer() > 24.0f * 60.0f) {  // 24 hours in minutes
-        plant->setState(new DecayingState());
-        delete this;
-    }
+    checkTransition(plant);
 }
 
 void RipeState::water(Plant* plant) {
     plant->setWaterLevel(100);
-    plant->setLastWateredTime(std::time(nullptr));
+    plant->setLastWateredTime(plant->getCurrentMinutes());
+}
+
+float RipeState::getTimeUntilTransition(const Plant* plant) const {
+    return PlantStateMachine::RIPE_MINUTES - plant->getDecayTimer();
 }
 
 // ============================================
@@ -88,18 +139,17 @@ void DecayingState::update(Plant* plant, float deltaTime) {
     // Decaying plants lose value over time
     plant->addDecayTimer(deltaTime);
     plant->updateWaterLevel(deltaTime);
-    
-    // After 48 hours decaying, plant dies
-    if (plant->getDecayTimer() > 72.0f * 60.0f) {  // 72 hours total
-        plant->setState(new DeadState());
-        delete this;
-    }
+    checkTransition(plant);
 }
 
 void DecayingState::water(Plant* plant) {
     // Watering can slow decay but not reverse it
     plant->setWaterLevel(100);
-    plant->setLastWateredTime(std::time(nullptr));
+    plant->setLastWateredTime(plant->getCurrentMinutes());
+}
+
+float DecayingState::getTimeUntilTransition(const Plant* plant) const {
+    return PlantStateMachine::DEAD_MINUTES - plant->getDecayTimer();
 }
 
 // ============================================
@@ -112,5 +162,10 @@ void DeadState::update(Plant* plant, float deltaTime) {
 
 void DeadState::water(Plant* plant) {
     // Watering a dead plant does nothing
-    std::cout << "Cannot water a dead plant!" << std::endl;
-}
\ No newline at end of file
+    LOG_WARN(PLANT, "Cannot water a dead plant!");
+}
+
+float DeadState::getTimeUntilTransition(const Plant*) const {
+    // Terminal state
+    return std::numeric_limits<float>::infinity();
+}
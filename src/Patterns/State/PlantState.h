@@ -2,73 +2,133 @@
 #define PLANTSTATE_H
 
 #include <string>
+#include <string_view>
+#include <cstdint>
 
 // Forward declaration
 class Plant;
 
+// Plant states, stored per plant as a single byte
+enum class PlantStateId : uint8_t {
+    SEED,
+    GROWING,
+    RIPE,
+    DECAYING,
+    DEAD,
+    COUNT
+};
+
 // State Pattern: Abstract base class for plant states
+// States hold no per-plant data, so one shared instance of each
+// serves every plant (Flyweight); plants store only the id.
 class PlantState {
 public:
     virtual ~PlantState() = default;
     
+    // Shared instance for a state id
+    static PlantState* get(PlantStateId id);
+    
+    // Names are only needed at save/UI boundaries; dispatch on the id
+    static const char* getName(PlantStateId id);
+    static bool getIdByName(std::string_view name, PlantStateId& id);
+    
+    virtual PlantStateId getId() const = 0;
+    
     // State behavior
     virtual void update(Plant* plant, float deltaTime) = 0;
+    void checkTransition(Plant* plant) const;  // Move on via PlantStateMachine's transition table
     virtual void water(Plant* plant) = 0;
     virtual bool canHarvest() const = 0;
-    virtual std::string getStateName() const = 0;
+    std::string getStateName() const { return getName(getId()); }
     
     // Visual representation (for rendering)
     virtual int getSpriteIndex() const = 0;
+    
+    // Event prediction (for the plant event scheduler)
+    // Time (deltaTime units) until this state's own transition; infinity if none
+    virtual float getTimeUntilTransition(const Plant* plant) const = 0;
+    virtual bool consumesWater() const = 0;
 };
 
 // Concrete State: Seed
 class SeedState : public PlantState {
 public:
+    static constexpr bool CONSUMES_WATER = false;
+    
+    PlantStateId getId() const override { return PlantStateId::SEED; }
     void update(Plant* plant, float deltaTime) override;
     void water(Plant* plant) override;
     bool canHarvest() const override { return false; }
-    std::string getStateName() const override { return "Seed"; }
     int getSpriteIndex() const override { return 0; }
+    float getTimeUntilTransition(const Plant* plant) const override;
+    bool consumesWater() const override { return CONSUMES_WATER; }
 };
 
 // Concrete State: Growing
 class GrowingState : public PlantState {
 public:
+    static constexpr bool CONSUMES_WATER = true;
+    
+    PlantStateId getId() const override { return PlantStateId::GROWING; }
     void update(Plant* plant, float deltaTime) override;
     void water(Plant* plant) override;
     bool canHarvest() const override { return false; }
-    std::string getStateName() const override { return "Growing"; }
     int getSpriteIndex() const override { return 1; }
+    float getTimeUntilTransition(const Plant* plant) const override;
+    bool consumesWater() const override { return CONSUMES_WATER; }
 };
 
 // Concrete State: Ripe (ready to harvest)
 class RipeState : public PlantState {
 public:
+    static constexpr bool CONSUMES_WATER = true;
+    
+    PlantStateId getId() const override { return PlantStateId::RIPE; }
     void update(Plant* plant, float deltaTime) override;
     void water(Plant* plant) override;
     bool canHarvest() const override { return true; }
-    std::string getStateName() const override { return "Ripe"; }
     int getSpriteIndex() const override { return 2; }
+    float getTimeUntilTransition(const Plant* plant) const override;
+    bool consumesWater() const override { return CONSUMES_WATER; }
 };
 
 // Concrete State: Decaying
 class DecayingState : public PlantState {
 public:
+    static constexpr bool CONSUMES_WATER = true;
+    
+    PlantStateId getId() const override { return PlantStateId::DECAYING; }
     void update(Plant* plant, float deltaTime) override;
     void water(Plant* plant) override;
     bool canHarvest() const override { return true; }  // Can still harvest but reduced value
-    std::string getStateName() const override { return "Decaying"; }
     int getSpriteIndex() const override { return 3; }
+    float getTimeUntilTransition(const Plant* plant) const override;
+    bool consumesWater() const override { return CONSUMES_WATER; }
 };
 
 // Concrete State: Dead (withered, needs removal)
 class DeadState : public PlantState {
 public:
+    static constexpr bool CONSUMES_WATER = false;
+    
+    PlantStateId getId() const override { return PlantStateId::DEAD; }
     void update(Plant* plant, float deltaTime) override;
     void water(Plant* plant) override;
     bool canHarvest() const override { return false; }
-    std::string getStateName() const override { return "Dead"; }
     int getSpriteIndex() const override { return 4; }
+    float getTimeUntilTransition(const Plant* plant) const override;
+    bool consumesWater() const override { return CONSUMES_WATER; }
 };
 
+// Concrete state class for an id, for code specialized per state at
+// compile time (PlantKernel)
+template <PlantStateId Id>
+struct PlantStateClass;
+
+template <> struct PlantStateClass<PlantStateId::SEED> { typedef SeedState Type; };
+template <> struct PlantStateClass<PlantStateId::GROWING> { typedef GrowingState Type; };
+template <> struct PlantStateClass<PlantStateId::RIPE> { typedef RipeState Type; };
+template <> struct PlantStateClass<PlantStateId::DECAYING> { typedef DecayingState Type; };
+template <> struct PlantStateClass<PlantStateId::DEAD> { typedef DeadState Type; };
+
 #endif // PLANTSTATE_H
\ No newline at end of file
@@ -0,0 +1,87 @@
+#ifndef PLANTSTATEMACHINE_H
+#define PLANTSTATEMACHINE_H
+
+#include "PlantState.h"
+
+// Things that can happen to a plant that move it between states
+enum class PlantStateEvent : uint8_t {
+    NONE,
+    GERMINATED,  // Seed reached germination progress
+    MATURED,     // Fully grown
+    NEGLECTED,   // Growth fell below zero without water
+    OVERRIPE,    // Left ripe too long
+    DECAYED,     // Left decaying too long
+    COUNT
+};
+
+// ============================================
+// PLANT STATE MACHINE (transition table)
+// ============================================
+// The plant lifecycle as data: detect() turns a plant's numbers into an
+// event, next() looks the event up in a constexpr table. Both are pure
+// functions of their arguments, so the FSM can be checked without a
+// Plant, a store or any allocation (see the static_asserts below).
+class PlantStateMachine {
+public:
+    // Thresholds (growth %, decay timer in game minutes)
+    static constexpr float GERMINATION_PROGRESS = 10.0f;
+    static constexpr float RIPE_PROGRESS = 100.0f;
+    static constexpr float RIPE_MINUTES = 24.0f * 60.0f;     // Ripe → Decaying
+    static constexpr float DEAD_MINUTES = 72.0f * 60.0f;     // Decaying → Dead (timer total)
+
+    static constexpr int STATE_COUNT = static_cast<int>(PlantStateId::COUNT);
+    static constexpr int EVENT_COUNT = static_cast<int>(PlantStateEvent::COUNT);
+
+    // [state][event] → next state; staying put means the event is ignored
+    static constexpr PlantStateId TRANSITIONS[STATE_COUNT][EVENT_COUNT] = {
+        //                 NONE                   GERMINATED                MATURED                NEGLECTED                  OVERRIPE                   DECAYED
+        /* SEED     */ {PlantStateId::SEED,     PlantStateId::GROWING,  PlantStateId::SEED,     PlantStateId::SEED,     PlantStateId::SEED,     PlantStateId::SEED},
+        /* GROWING  */ {PlantStateId::GROWING,  PlantStateId::GROWING,  PlantStateId::RIPE,     PlantStateId::DECAYING, PlantStateId::GROWING,  PlantStateId::GROWING},
+        /* RIPE     */ {PlantStateId::RIPE,     PlantStateId::RIPE,     PlantStateId::RIPE,     PlantStateId::RIPE,     PlantStateId::DECAYING, PlantStateId::RIPE},
+        /* DECAYING */ {PlantStateId::DECAYING, PlantStateId::DECAYING, PlantStateId::DECAYING, PlantStateId::DECAYING, PlantStateId::DECAYING, PlantStateId::DEAD},
+        /* DEAD     */ {PlantStateId::DEAD,     PlantStateId::DEAD,     PlantStateId::DEAD,     PlantStateId::DEAD,     PlantStateId::DEAD,     PlantStateId::DEAD}
+    };
+
+    static constexpr PlantStateId next(PlantStateId state, PlantStateEvent event) {
+        return TRANSITIONS[static_cast<int>(state)][static_cast<int>(event)];
+    }
+
+    // Event (if any) a plant in this state raises with these values
+    static constexpr PlantStateEvent detect(PlantStateId state, float growthProgress, float decayTimer) {
+        switch (state) {
+            case PlantStateId::SEED:
+                return growthProgress >= GERMINATION_PROGRESS ? PlantStateEvent::GERMINATED : PlantStateEvent::NONE;
+            case PlantStateId::GROWING:
+                if (growthProgress >= RIPE_PROGRESS) {
+                    return PlantStateEvent::MATURED;
+                }
+                return growthProgress < 0.0f ? PlantStateEvent::NEGLECTED : PlantStateEvent::NONE;
+            case PlantStateId::RIPE:
+                return decayTimer > RIPE_MINUTES ? PlantStateEvent::OVERRIPE : PlantStateEvent::NONE;
+            case PlantStateId::DECAYING:
+                return decayTimer > DEAD_MINUTES ? PlantStateEvent::DECAYED : PlantStateEvent::NONE;
+            default:
+                return PlantStateEvent::NONE;
+        }
+    }
+
+    // State a plant with these values should be in after one check
+    static constexpr PlantStateId step(PlantStateId state, float growthProgress, float decayTimer) {
+        return next(state, detect(state, growthProgress, decayTimer));
+    }
+};
+
+// ============================================
+// Lifecycle checks (compile time)
+// ============================================
+static_assert(PlantStateMachine::step(PlantStateId::SEED, 9.9f, 0.0f) == PlantStateId::SEED, "seed waits for germination");
+static_assert(PlantStateMachine::step(PlantStateId::SEED, 10.0f, 0.0f) == PlantStateId::GROWING, "seed germinates at 10%");
+static_assert(PlantStateMachine::step(PlantStateId::GROWING, 100.0f, 0.0f) == PlantStateId::RIPE, "grown plant ripens");
+static_assert(PlantStateMachine::step(PlantStateId::GROWING, -0.1f, 0.0f) == PlantStateId::DECAYING, "neglected plant decays");
+static_assert(PlantStateMachine::step(PlantStateId::RIPE, 0.0f, 24.0f * 60.0f) == PlantStateId::RIPE, "ripe for a full day");
+static_assert(PlantStateMachine::step(PlantStateId::RIPE, 0.0f, 24.0f * 60.0f + 1.0f) == PlantStateId::DECAYING, "overripe plant decays");
+static_assert(PlantStateMachine::step(PlantStateId::DECAYING, 0.0f, 72.0f * 60.0f + 1.0f) == PlantStateId::DEAD, "decayed plant dies");
+static_assert(PlantStateMachine::step(PlantStateId::DEAD, 100.0f, 1e9f) == PlantStateId::DEAD, "dead is terminal");
+static_assert(PlantStateMachine::next(PlantStateId::SEED, PlantStateEvent::MATURED) == PlantStateId::SEED, "events outside a state are ignored");
+
+#endif // PLANTSTATEMACHINE_H
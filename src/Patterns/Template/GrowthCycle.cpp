@@ -1,26 +1,32 @@
 #include "GrowthCycle.h"
 #include "../../Greenhouse/Plant.h"
 
+// ============================================
+// Shared cycle instances (Flyweight)
+// ============================================
+GrowthCycle* GrowthCycle::get(GrowthCycleId id) {
+    static NormalGrowthCycle normal;
+    static BoostedGrowthCycle boosted;
+    
+    return id == GrowthCycleId::BOOSTED ? static_cast<GrowthCycle*>(&boosted) : &normal;
+}
+
 // ============================================
 // NormalGrowthCycle Implementation
 // ============================================
+float NormalGrowthCycle::getGrowthModifierFor(int waterLevel) const {
+    typedef GrowthCycleTraits<GrowthCycleId::NORMAL> Traits;
+    return waterLevel < LOW_WATER_LEVEL ? Traits::DRY_MODIFIER : Traits::WET_MODIFIER;
+}
+
 void NormalGrowthCycle::checkEnvironment(Plant* plant) {
     // Check if plant has adequate water
-    if (plant->getWaterLevel() < 20) {
-        // Low water affects growth
-        plant->setGrowthModifier(0.5f);
-    } else {
-        plant->setGrowthModifier(1.0f);
-    }
+    plant->setGrowthModifier(getGrowthModifierFor(plant->getWaterLevel()));
 }
 
 void NormalGrowthCycle::calculateGrowthRate(Plant* plant, float deltaTime) {
-    // Base growth rate depends on plant type
-    const PlantTypeInfo& info = plant->getPlantTypeInfo();
-    
-    // Calculate growth per minute (convert hours to minutes)
-    float totalMinutes = info.growthTimeHours * 60.0f;
-    float growthPerMinute = 100.0f / totalMinutes;
+    // Base growth rate depends on plant type (per minute, from the catalog)
+    float growthPerMinute = plant->getPlantTypeInfo().growthPerMinute;
     
     // Apply time delta (deltaTime is in game minutes)
     float growth = growthPerMinute * deltaTime * plant->getGrowthModifier();
@@ -39,22 +45,20 @@ void NormalGrowthCycle::checkStateTransition(Plant* plant) {
 // ============================================
 // BoostedGrowthCycle Implementation
 // ============================================
-void BoostedGrowthCycle::checkEnvironment(Plant* plant) {
+float BoostedGrowthCycle::getGrowthModifierFor(int waterLevel) const {
     // Boosted growth is less affected by low water
-    if (plant->getWaterLevel() < 20) {
-        plant->setGrowthModifier(0.75f * boostMultiplier);
-    } else {
-        plant->setGrowthModifier(1.0f * boostMultiplier);
-    }
+    typedef GrowthCycleTraits<GrowthCycleId::BOOSTED> Traits;
+    return waterLevel < LOW_WATER_LEVEL ? Traits::DRY_MODIFIER : Traits::WET_MODIFIER;
+}
+
+void BoostedGrowthCycle::checkEnvironment(Plant* plant) {
+    plant->setGrowthModifier(getGrowthModifierFor(plant->getWaterLevel()));
 }
 
 void BoostedGrowthCycle::calculateGrowthRate(Plant* plant, float deltaTime) {
-    const PlantTypeInfo& info = plant->getPlantTypeInfo();
-    
-    float totalMinutes = info.growthTimeHours * 60.0f;
-    float growthPerMinute = 100.0f / totalMinutes;
+    float growthPerMinute = plant->getPlantTypeInfo().growthPerMinute;
     
-    // Apply boost multiplier
+    // The boost is part of the growth modifier
     float growth = growthPerMinute * deltaTime * plant->getGrowthModifier();
     plant->setPendingGrowth(growth);
 }
@@ -1,13 +1,49 @@
 #ifndef GROWTHCYCLE_H
 #define GROWTHCYCLE_H
 
+#include <cstdint>
+
 class Plant;
 
+// Growth cycles, stored per plant as a single byte
+enum class GrowthCycleId : uint8_t {
+    NORMAL,
+    BOOSTED,
+    COUNT
+};
+
+constexpr int GROWTH_CYCLE_COUNT = static_cast<int>(GrowthCycleId::COUNT);
+
+// Modifiers of the shared cycle instances as compile-time constants, so
+// PlantKernel can fold them into a kernel per cycle
+template <GrowthCycleId Id>
+struct GrowthCycleTraits;
+
+template <>
+struct GrowthCycleTraits<GrowthCycleId::NORMAL> {
+    static constexpr float DRY_MODIFIER = 0.5f;  // Low water affects growth
+    static constexpr float WET_MODIFIER = 1.0f;
+};
+
+template <>
+struct GrowthCycleTraits<GrowthCycleId::BOOSTED> {
+    static constexpr float BOOST = 1.5f;  // 50% faster growth
+    static constexpr float DRY_MODIFIER = 0.75f * BOOST;  // Less affected by low water
+    static constexpr float WET_MODIFIER = 1.0f * BOOST;
+};
+
 // Template Method Pattern: Abstract growth algorithm
+// Cycles hold no per-plant data; plants share one instance per id.
 class GrowthCycle {
 public:
     virtual ~GrowthCycle() = default;
     
+    // Below this water level the cycle switches to its low-water modifier
+    static const int LOW_WATER_LEVEL = 20;
+    
+    // Shared instance for a cycle id
+    static GrowthCycle* get(GrowthCycleId id);
+    
     // Template Method: Defines the skeleton of the growth algorithm
     void executeGrowthCycle(Plant* plant, float deltaTime) {
         checkEnvironment(plant);
@@ -16,6 +52,10 @@ public:
         checkStateTransition(plant);
     }
     
+    // Growth modifier this cycle applies at a given water level
+    // (used to predict when a plant's next event is due)
+    virtual float getGrowthModifierFor(int waterLevel) const = 0;
+    
 protected:
     // Abstract methods to be implemented by subclasses
     virtual void checkEnvironment(Plant* plant) = 0;
@@ -26,6 +66,9 @@ protected:
 
 // Concrete implementation: Normal growth cycle
 class NormalGrowthCycle : public GrowthCycle {
+public:
+    float getGrowthModifierFor(int waterLevel) const override;
+    
 protected:
     void checkEnvironment(Plant* plant) override;
     void calculateGrowthRate(Plant* plant, float deltaTime) override;
@@ -35,11 +78,8 @@ protected:
 
 // Concrete implementation: Boosted growth (with nutrients)
 class BoostedGrowthCycle : public GrowthCycle {
-private:
-    float boostMultiplier;
-    
 public:
-    BoostedGrowthCycle(float multiplier = 1.5f) : boostMultiplier(multiplier) {}
+    float getGrowthModifierFor(int waterLevel) const override;
     
 protected:
     void checkEnvironment(Plant* plant) override;
@@ -4,7 +4,7 @@
 #include "Customer/Robber.h"
 #include "Greenhouse/PlantTypes.h"
 #include "Core/Config.h"
-#include <iostream>
+#include "Core/Logger.h"
 
 // ============================================
 // ServeCustomerVisitor Implementation
@@ -17,8 +17,8 @@ void ServeCustomerVisitor::visitRegularCustomer(RegularCustomer* customer) {
     PlantTypeDatabase* db = PlantTypeDatabase::getInstance();
     const PlantTypeInfo& plantInfo = db->getPlantInfo(customer->getRequestedPlant());
     
-    std::cout << "  Serving " << customer->getName() 
-              << " - Wants: " << plantInfo.name << std::endl;
+    LOG_INFO(CUSTOMER, "  Serving " << customer->getName() 
+                       << " - Wants: " << plantInfo.name);
     
     if (hasInventory) {
         double price = plantInfo.sellPrice;
@@ -26,12 +26,12 @@ void ServeCustomerVisitor::visitRegularCustomer(RegularCustomer* customer) {
         rating += Config::RATING_SUCCESS_BONUS;
         customer->setServed(true);
         
-        std::cout << "  ✅ Sold for $" << price << std::endl;
+        LOG_INFO(CUSTOMER, "  ✅ Sold for $" << price);
     } else {
         rating -= Config::RATING_NO_STOCK_PENALTY;
         customer->markLeftAngry();
         
-        std::cout << "  ❌ Out of stock! Customer left unhappy." << std::endl;
+        LOG_WARN(CUSTOMER, "  ❌ Out of stock! Customer left unhappy.");
     }
 }
 
@@ -39,8 +39,8 @@ void ServeCustomerVisitor::visitVIPCustomer(VIPCustomer* customer) {
     PlantTypeDatabase* db = PlantTypeDatabase::getInstance();
     const PlantTypeInfo& plantInfo = db->getPlantInfo(customer->getRequestedPlant());
     
-    std::cout << "  Serving VIP " << customer->getName() 
-              << " - Wants: " << plantInfo.name << std::endl;
+    LOG_INFO(CUSTOMER, "  Serving VIP " << customer->getName() 
+                       << " - Wants: " << plantInfo.name);
     
     if (hasInventory) {
         double price = plantInfo.sellPrice * customer->getPriceMultiplier();
@@ -48,17 +48,17 @@ void ServeCustomerVisitor::visitVIPCustomer(VIPCustomer* customer) {
         rating += Config::RATING_SUCCESS_BONUS * 2.0f;  // VIPs boost rating more
         customer->setServed(true);
         
-        std::cout << "  ✅ Sold for $" << price << " (VIP bonus!)" << std::endl;
+        LOG_INFO(CUSTOMER, "  ✅ Sold for $" << price << " (VIP bonus!)");
     } else {
         rating -= Config::RATING_NO_STOCK_PENALTY * 1.5f;  // VIPs are more disappointed
         customer->markLeftAngry();
         
-        std::cout << "  ❌ Out of stock! VIP left very unhappy." << std::endl;
+        LOG_WARN(CUSTOMER, "  ❌ Out of stock! VIP left very unhappy.");
     }
 }
 
 void ServeCustomerVisitor::visitRobber(Robber* robber) {
-    std::cout << "  🚨 ROBBER DETECTED: " << robber->getName() << std::endl;
+    LOG_INFO(CUSTOMER, "  🚨 ROBBER DETECTED: " << robber->getName());
     
     // Security check (simplified - would check for security workers)
     bool hasSecurityCheck = false;  // In full game, check for security workers
@@ -66,11 +66,11 @@ void ServeCustomerVisitor::visitRobber(Robber* robber) {
     if (hasSecurityCheck) {
         robber->setCaught(true);
         rating += Config::RATING_SECURITY_BONUS;
-        std::cout << "  🛡️  Robber caught by security!" << std::endl;
+        LOG_INFO(CUSTOMER, "  🛡️  Robber caught by security!");
     } else {
         cashRegister -= robber->getAttemptedTheftAmount();
         rating -= Config::RATING_ROBBERY_PENALTY;
-        std::cout << "  💸 Robber stole $" << robber->getAttemptedTheftAmount() << "!" << std::endl;
+        LOG_WARN(CUSTOMER, "  💸 Robber stole $" << robber->getAttemptedTheftAmount() << "!");
     }
 }
 
@@ -81,24 +81,24 @@ void DisplayCustomerVisitor::visitRegularCustomer(RegularCustomer* customer) {
     PlantTypeDatabase* db = PlantTypeDatabase::getInstance();
     const PlantTypeInfo& plantInfo = db->getPlantInfo(customer->getRequestedPlant());
     
-    std::cout << "👤 " << customer->getName() 
-              << " (Regular) - Wants: " << plantInfo.name
-              << " | Wait: " << customer->getWaitTimer() << "s" << std::endl;
+    LOG_INFO(CUSTOMER, "👤 " << customer->getName() 
+                       << " (Regular) - Wants: " << plantInfo.name
+                       << " | Wait: " << customer->getWaitTimer() << "s");
 }
 
 void DisplayCustomerVisitor::visitVIPCustomer(VIPCustomer* customer) {
     PlantTypeDatabase* db = PlantTypeDatabase::getInstance();
     const PlantTypeInfo& plantInfo = db->getPlantInfo(customer->getRequestedPlant());
     
-    std::cout << "⭐ " << customer->getName() 
-              << " (VIP) - Wants: " << plantInfo.name
-              << " | Wait: " << customer->getWaitTimer() << "s" << std::endl;
+    LOG_INFO(CUSTOMER, "⭐ " << customer->getName() 
+                       << " (VIP) - Wants: " << plantInfo.name
+                       << " | Wait: " << customer->getWaitTimer() << "s");
 }
 
 void DisplayCustomerVisitor::visitRobber(Robber* robber) {
-    std::cout << "🚨 " << robber->getName() 
-              << " (ROBBER) - Attempting to steal $" 
-              << robber->getAttemptedTheftAmount() << std::endl;
+    LOG_INFO(CUSTOMER, "🚨 " << robber->getName() 
+                       << " (ROBBER) - Attempting to steal $" 
+                       << robber->getAttemptedTheftAmount());
 }
 
 // ============================================
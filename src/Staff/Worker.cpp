@@ -2,9 +2,10 @@
 #include "Core/Config.h"  // ← ADD THIS LINE
 #include "Patterns/Decorator/WorkerRole.h"
 #include "Patterns/Command/Command.h"
+#include "Core/Tracer.h"
+#include "Core/Logger.h"
+#include "Core/Random.h"
 #include <algorithm>
-#include <iostream>
-#include <random>
 
 Worker::Worker(int workerId, const std::string& workerName)
     : id(workerId), name(workerName),
@@ -13,14 +14,11 @@ Worker::Worker(int workerId, const std::string& workerName)
       assignedZone(-1), isBusy(false), busyTimer(0.0f) {
     
     // Randomize starting skills (1-2 stars)
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> dist(1, 2);
-    
-    wateringSkill = dist(gen);
-    harvestingSkill = dist(gen);
-    cashierSkill = dist(gen);
-    securitySkill = dist(gen);
+    RandomStream& random = RandomService::stream(RandomStreamId::WORKERS);
+    wateringSkill = random.nextInt(1, 2);
+    harvestingSkill = random.nextInt(1, 2);
+    cashierSkill = random.nextInt(1, 2);
+    securitySkill = random.nextInt(1, 2);
 }
 
 Worker::~Worker() {
@@ -92,6 +90,7 @@ std::vector<std::string> Worker::getRoleNames() const {
 void Worker::addTask(Command* task) {
     if (task != nullptr) {
         taskQueue.push_back(task);
+        Tracer::getInstance()->async(TracePhase::ASYNC_INSTANT, "assigned", "task", task->getTraceId());
     }
 }
 
@@ -102,9 +101,16 @@ void Worker::executeNextTask() {
     
     Command* task = taskQueue.front();
     taskQueue.erase(taskQueue.begin());
+    if (task->isStale()) {
+        delete task;  // Nothing left to do, and no experience for it
+        return;
+    }
     
     // Execute task
+    Tracer* tracer = Tracer::getInstance();
+    tracer->async(TracePhase::ASYNC_BEGIN, "execute", "task", task->getTraceId());
     task->execute();
+    tracer->async(TracePhase::ASYNC_END, "execute", "task", task->getTraceId());
     
     // Gain experience
     gainExperience(10);
@@ -120,19 +126,32 @@ void Worker::clearTasks() {
     taskQueue.clear();
 }
 
+int Worker::discardStaleTasks() {
+    size_t before = taskQueue.size();
+    auto stale = std::remove_if(taskQueue.begin(), taskQueue.end(), [](Command* task) {
+        if (task->isStale()) {
+            delete task;
+            return true;
+        }
+        return false;
+    });
+    taskQueue.erase(stale, taskQueue.end());
+    return static_cast<int>(before - taskQueue.size());
+}
+
 void Worker::trainSkill(const std::string& skillName) {
     if (skillName == "watering" && wateringSkill < 5) {
         wateringSkill++;
-        std::cout << name << " trained Watering skill to " << wateringSkill << " stars!" << std::endl;
+        LOG_INFO(STAFF, name << " trained Watering skill to " << wateringSkill << " stars!");
     } else if (skillName == "harvesting" && harvestingSkill < 5) {
         harvestingSkill++;
-        std::cout << name << " trained Harvesting skill to " << harvestingSkill << " stars!" << std::endl;
+        LOG_INFO(STAFF, name << " trained Harvesting skill to " << harvestingSkill << " stars!");
     } else if (skillName == "cashier" && cashierSkill < 5) {
         cashierSkill++;
-        std::cout << name << " trained Cashier skill to " << cashierSkill << " stars!" << std::endl;
+        LOG_INFO(STAFF, name << " trained Cashier skill to " << cashierSkill << " stars!");
     } else if (skillName == "security" && securitySkill < 5) {
         securitySkill++;
-        std::cout << name << " trained Security skill to " << securitySkill << " stars!" << std::endl;
+        LOG_INFO(STAFF, name << " trained Security skill to " << securitySkill << " stars!");
     }
 }
 
@@ -180,8 +199,8 @@ void Worker::levelUp() {
     // Increase salary
     salary += 5.0;
     
-    std::cout << "🎉 " << name << " leveled up to Level " << overallLevel << "!" << std::endl;
-    std::cout << "   Salary increased to $" << salary << "/day" << std::endl;
+    LOG_INFO(STAFF, "🎉 " << name << " leveled up to Level " << overallLevel << "!");
+    LOG_INFO(STAFF, "   Salary increased to $" << salary << "/day");
 }
 
 bool Worker::canLevelUp() const {
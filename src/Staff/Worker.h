@@ -4,13 +4,14 @@
 #include <string>
 #include <vector>
 #include "Core/GameData.h"  // ← Fixed
+#include "Core/LiveCount.h"
 
 // Forward declarations
 class WorkerRole;
 class Command;
 
 // Base Worker class
-class Worker {
+class Worker : public LiveCount<Worker> {
 private:
     // Identity
     int id;
@@ -58,6 +59,7 @@ public:
     void addTask(Command* task);
     void executeNextTask();
     void clearTasks();
+    int discardStaleTasks();  // Returns the number dropped
     int getTaskCount() const { return taskQueue.size(); }
     
     // Skill management
@@ -0,0 +1,897 @@
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <chrono>
+#include <cstdlib>
+#include <cmath>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <algorithm>
+#include "Core/Simulation.h"
+#include "Core/Logger.h"
+#include "Core/Random.h"
+#include "Greenhouse/PlantKernel.h"
+#include "Greenhouse/PlantStore.h"
+#include "Greenhouse/PlantTypes.h"
+#include "Staff/Worker.h"
+#include "Patterns/Decorator/WorkerRole.h"
+#include "Patterns/Mediator/WorkScheduler.h"
+#include "Patterns/Iterator/InventoryIterator.h"
+#include "Patterns/Factory/CustomerFactory.h"
+#include "Patterns/Visitor/CustomerVisitor.h"
+#include "Customer/Customer.h"
+
+// ============================================
+// BENCHMARK DRIVER
+// ============================================
+// Micro-benchmarks for simulation hot paths. Each ISA the CPU supports
+// is timed on the same input and checked against the scalar reference.
+// Scenario benchmarks (plant updates, task assignment, inventory lookup,
+// snapshots, customers) run once per grid size so results trace a
+// scaling curve; --json writes every result for tracking across builds.
+
+typedef std::chrono::steady_clock BenchClock;
+
+struct GridSize {
+    int width;
+    int height;
+};
+
+struct BenchOptions {
+    int plants;       // Lanes per batch
+    int iterations;   // Batches timed per ISA
+    std::vector<GridSize> grids;  // Scenario grid sizes
+    int threads;      // Simulation plant threads (0 = all cores)
+    bool runKernel;
+    bool runScenarios;
+    std::string jsonFile;
+
+    BenchOptions() : plants(1 << 16), iterations(200), threads(Config::SIM_WORKER_THREADS),
+                     runKernel(true), runScenarios(true) {}
+};
+
+// Default sweep when --grids is not given
+const char* const DEFAULT_GRIDS = "3x3,10x10,32x32,100x100,316x316,1000x1000";
+
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --plants N      Plants per kernel batch (default 65536)\n"
+              << "  --iterations N  Kernel batches per measurement (default 200)\n"
+              << "  --grids LIST    Scenario grid sizes, e.g. 3x3,100x100 (default " << DEFAULT_GRIDS << ")\n"
+              << "  --threads N     Simulation plant threads (default 0 = all cores)\n"
+              << "  --suite NAME    kernel, scenarios or all (default all)\n"
+              << "  --json FILE     Write all results as JSON to FILE\n"
+              << "  --help          Show this message" << std::endl;
+}
+
+bool parseGrids(const std::string& value, std::vector<GridSize>& grids) {
+    grids.clear();
+    size_t begin = 0;
+    while (begin <= value.size()) {
+        size_t end = value.find(',', begin);
+        if (end == std::string::npos) {
+            end = value.size();
+        }
+        std::string item = value.substr(begin, end - begin);
+        size_t sep = item.find('x');
+        if (sep == std::string::npos) {
+            return false;
+        }
+        GridSize grid;
+        grid.width = std::atoi(item.substr(0, sep).c_str());
+        grid.height = std::atoi(item.substr(sep + 1).c_str());
+        if (grid.width <= 0 || grid.height <= 0) {
+            return false;
+        }
+        grids.push_back(grid);
+        begin = end + 1;
+    }
+    return !grids.empty();
+}
+
+bool parseOptions(int argc, char* argv[], BenchOptions& options) {
+    parseGrids(DEFAULT_GRIDS, options.grids);
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+
+        if (arg == "--plants" && hasValue) {
+            options.plants = std::atoi(argv[++i]);
+        } else if (arg == "--iterations" && hasValue) {
+            options.iterations = std::atoi(argv[++i]);
+        } else if (arg == "--grids" && hasValue) {
+            if (!parseGrids(argv[++i], options.grids)) {
+                std::cerr << "Invalid grid list: " << argv[i] << std::endl;
+                return false;
+            }
+        } else if (arg == "--threads" && hasValue) {
+            options.threads = std::atoi(argv[++i]);
+        } else if (arg == "--suite" && hasValue) {
+            std::string suite = argv[++i];
+            options.runKernel = (suite == "kernel" || suite == "all");
+            options.runScenarios = (suite == "scenarios" || suite == "all");
+            if (!options.runKernel && !options.runScenarios) {
+                std::cerr << "Invalid suite: " << suite << std::endl;
+                return false;
+            }
+        } else if (arg == "--json" && hasValue) {
+            options.jsonFile = argv[++i];
+        } else {
+            printUsage(argv[0]);
+            return false;
+        }
+    }
+
+    return options.plants > 0 && options.iterations > 0 && options.threads >= 0;
+}
+
+// ============================================
+// RESULTS
+// ============================================
+
+struct KernelResult {
+    std::string state;
+    std::string isa;
+    double nsPerPlant;
+    double maxError;
+};
+
+struct ScenarioResult {
+    std::string name;
+    GridSize grid;
+    std::string unit;       // What one operation is
+    long long operations;
+    double seconds;
+
+    double nsPerOperation() const { return operations > 0 ? seconds * 1e9 / operations : 0.0; }
+};
+
+struct BenchResults {
+    std::vector<KernelResult> kernel;
+    std::vector<ScenarioResult> scenarios;
+};
+
+double secondsSince(BenchClock::time_point start) {
+    std::chrono::duration<double> elapsed = BenchClock::now() - start;
+    return elapsed.count();
+}
+
+// Spread a fixed amount of work over each grid size: at least minimum
+// repetitions, more on small grids so timings stay above clock noise
+long long scaledCount(long long work, long long perRepetition, long long minimum, long long maximum) {
+    long long count = work / std::max(1LL, perRepetition);
+    return std::max(minimum, std::min(maximum, count));
+}
+
+// ============================================
+// GROWTH KERNEL BENCHMARK
+// ============================================
+
+// Owns the arrays behind a PlantLanes view
+struct KernelData {
+    std::vector<float> growthProgress;
+    std::vector<int> waterLevel;
+    std::vector<float> waterDeficit;
+    std::vector<float> decayTimer;
+    std::vector<float> growthModifier;
+    std::vector<float> pendingGrowth;
+    std::vector<float> cycleProgress;
+    std::vector<int> attention;
+    std::vector<float> deltaTime;
+    std::vector<float> growthPerMinute;
+    std::vector<float> depletionRate;
+
+    explicit KernelData(int count)
+        : growthProgress(count), waterLevel(count), waterDeficit(count), decayTimer(count),
+          growthModifier(count), pendingGrowth(count), cycleProgress(count), attention(count), deltaTime(count),
+          growthPerMinute(count), depletionRate(count) {
+
+        // Deterministic spread of types, water levels and catch-up spans
+        unsigned int seed = 12345u;
+        for (int i = 0; i < count; i++) {
+            seed = seed * 1664525u + 1013904223u;
+            growthProgress[i] = static_cast<float>(seed % 10000) / 100.0f;
+            waterLevel[i] = static_cast<int>((seed >> 8) % 101);
+            waterDeficit[i] = static_cast<float>((seed >> 4) % 100) / 100.0f;
+            decayTimer[i] = static_cast<float>((seed >> 12) % 4000);
+            deltaTime[i] = 1.0f + static_cast<float>((seed >> 16) % 60);
+
+            int growthHours = 1 + static_cast<int>((seed >> 20) % 48);
+            int waterHours = 1 + static_cast<int>((seed >> 24) % 12);
+            growthPerMinute[i] = 100.0f / (growthHours * 60.0f);
+            depletionRate[i] = 100.0f / static_cast<float>(waterHours);
+        }
+    }
+
+    int size() const { return static_cast<int>(growthProgress.size()); }
+
+    PlantLanes lanes(int begin, int count) {
+        PlantLanes result;
+        result.count = count;
+        result.growthProgress = growthProgress.data() + begin;
+        result.waterLevel = waterLevel.data() + begin;
+        result.waterDeficit = waterDeficit.data() + begin;
+        result.decayTimer = decayTimer.data() + begin;
+        result.growthModifier = growthModifier.data() + begin;
+        result.pendingGrowth = pendingGrowth.data() + begin;
+        result.cycleProgress = cycleProgress.data() + begin;
+        result.attention = attention.data() + begin;
+        result.deltaTime = deltaTime.data() + begin;
+        result.growthPerMinute = growthPerMinute.data() + begin;
+        result.depletionRate = depletionRate.data() + begin;
+        return result;
+    }
+
+    // First half of the lanes on the normal cycle, the rest boosted
+    void advance(PlantStateId state, KernelIsa isa) {
+        int half = size() / 2;
+        PlantKernel::advance(state, GrowthCycleId::NORMAL, lanes(0, half), isa);
+        PlantKernel::advance(state, GrowthCycleId::BOOSTED, lanes(half, size() - half), isa);
+    }
+};
+
+// Largest accepted difference between an ISA and the scalar path
+const double KERNEL_TOLERANCE = 1e-4;
+
+// Largest difference from the scalar reference after one batch
+double compareWithScalar(PlantStateId state, KernelIsa isa, int plants) {
+    KernelData reference(plants);
+    KernelData candidate(plants);
+    reference.advance(state, KernelIsa::SCALAR);
+    candidate.advance(state, isa);
+
+    double maxError = 0.0;
+    for (int i = 0; i < plants; i++) {
+        maxError = std::max(maxError, static_cast<double>(std::fabs(reference.growthProgress[i] - candidate.growthProgress[i])));
+        maxError = std::max(maxError, static_cast<double>(std::fabs(reference.waterDeficit[i] - candidate.waterDeficit[i])));
+        maxError = std::max(maxError, static_cast<double>(std::fabs(reference.decayTimer[i] - candidate.decayTimer[i])));
+        maxError = std::max(maxError, static_cast<double>(std::abs(reference.waterLevel[i] - candidate.waterLevel[i])));
+        if ((reference.attention[i] != 0) != (candidate.attention[i] != 0)) {
+            maxError = std::max(maxError, 1.0);  // A lane the caller would skip or visit wrongly
+        }
+    }
+    return maxError;
+}
+
+// Nanoseconds per plant for one state and ISA
+double timeKernel(PlantStateId state, KernelIsa isa, const BenchOptions& options) {
+    KernelData data(options.plants);
+
+    // Keep values in range so every iteration does the same work
+    KernelData pristine(options.plants);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int iteration = 0; iteration < options.iterations; iteration++) {
+        data.advance(state, isa);
+        if ((iteration & 15) == 15) {
+            std::copy(pristine.growthProgress.begin(), pristine.growthProgress.end(), data.growthProgress.begin());
+            std::copy(pristine.waterLevel.begin(), pristine.waterLevel.end(), data.waterLevel.begin());
+        }
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    return elapsed.count() * 1e9 / (static_cast<double>(options.plants) * options.iterations);
+}
+
+// Returns false if any ISA drifts from the scalar reference
+bool benchGrowthKernel(const BenchOptions& options, BenchResults& results) {
+    const PlantStateId states[] = {PlantStateId::SEED, PlantStateId::GROWING,
+                                   PlantStateId::RIPE, PlantStateId::DECAYING};
+    const KernelIsa isas[] = {KernelIsa::SCALAR, KernelIsa::SSE2, KernelIsa::AVX2};
+    bool matches = true;
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "  GROWTH KERNEL (" << options.plants << " plants x "
+              << options.iterations << " batches)" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Runtime dispatch selects: " << PlantKernel::getIsaName(PlantKernel::getBestIsa()) << std::endl;
+    std::cout << std::left << std::setw(10) << "State" << std::setw(8) << "ISA"
+              << std::right << std::setw(12) << "ns/plant" << std::setw(10) << "speedup"
+              << std::setw(12) << "max error" << std::endl;
+
+    for (PlantStateId state : states) {
+        std::string name = PlantState::get(state)->getStateName();
+        double scalarTime = 0.0;
+
+        for (KernelIsa isa : isas) {
+            if (!PlantKernel::isSupported(isa)) {
+                continue;
+            }
+
+            double nsPerPlant = timeKernel(state, isa, options);
+            double maxError = compareWithScalar(state, isa, options.plants);
+            if (maxError > KERNEL_TOLERANCE) {
+                matches = false;
+            }
+            if (isa == KernelIsa::SCALAR) {
+                scalarTime = nsPerPlant;
+            }
+            KernelResult result = {name, PlantKernel::getIsaName(isa), nsPerPlant, maxError};
+            results.kernel.push_back(result);
+
+            std::cout << std::left << std::setw(10) << name << std::setw(8) << PlantKernel::getIsaName(isa)
+                      << std::right << std::fixed << std::setprecision(3) << std::setw(12) << nsPerPlant
+                      << std::setprecision(2) << std::setw(9) << scalarTime / nsPerPlant << "x"
+                      << std::scientific << std::setprecision(1) << std::setw(12)
+                      << maxError << std::endl;
+        }
+    }
+
+    if (!matches) {
+        std::cout << "❌ Vector kernel differs from the scalar reference!" << std::endl;
+    }
+    return matches;
+}
+
+// ============================================
+// GROWTH DISPATCH BENCHMARK
+// ============================================
+// The batched path (PlantStore::advance: lanes grouped by state and
+// growth cycle, each group through its specialized kernel from the jump
+// table) against the per-plant virtual path (Plant::update: Template
+// Method growth cycle, then the state's update) on identical stores
+
+// Every catalog type, the four living states and both cycles spread over
+// the slots
+void fillDispatchStore(PlantStore& store, std::vector<Plant*>& plants) {
+    int typeCount = PlantTypeDatabase::getPlantTypeCount();
+    unsigned int seed = 54321u;
+    for (int slot = 0; slot < static_cast<int>(plants.size()); slot++) {
+        seed = seed * 1664525u + 1013904223u;
+        Plant* plant = store.create(slot, slot + 1, static_cast<PlantType>(slot % typeCount), slot, 0);
+        plant->setGrowthProgress(static_cast<float>(seed % 10000) / 100.0f);
+        plant->setWaterLevel(static_cast<int>((seed >> 8) % 101));
+        plant->setState(static_cast<PlantStateId>((seed >> 16) % 4));
+        if (((seed >> 28) & 1u) != 0) {
+            plant->applyNutrient();
+        }
+        plants[slot] = plant;
+    }
+}
+
+// Largest difference between two stores' plants, and how many plants
+// ended in a different state
+double compareStores(const std::vector<Plant*>& batched, const std::vector<Plant*>& single, int& stateMismatches) {
+    double maxError = 0.0;
+    stateMismatches = 0;
+    for (size_t slot = 0; slot < batched.size(); slot++) {
+        maxError = std::max(maxError, static_cast<double>(std::fabs(batched[slot]->getGrowthProgress() -
+                                                                    single[slot]->getGrowthProgress())));
+        maxError = std::max(maxError, static_cast<double>(std::abs(batched[slot]->getWaterLevel() -
+                                                                   single[slot]->getWaterLevel())));
+        if (batched[slot]->getStateId() != single[slot]->getStateId()) {
+            stateMismatches++;
+        }
+    }
+    return maxError;
+}
+
+// Returns false if any batched run ends in different plant states
+bool benchGrowthDispatch(const BenchOptions& options, BenchResults& results) {
+    int count = options.plants;
+    int rounds = std::max(1, options.iterations / 10);
+
+    std::vector<int> slots(count);
+    std::vector<float> deltaTimes(count);
+    for (int slot = 0; slot < count; slot++) {
+        slots[slot] = slot;
+        deltaTimes[slot] = 1.0f + static_cast<float>(slot % 10);
+    }
+
+    PlantStore virtualStore(count);
+    std::vector<Plant*> virtualPlants(count);
+    fillDispatchStore(virtualStore, virtualPlants);
+
+    BenchClock::time_point start = BenchClock::now();
+    for (int round = 0; round < rounds; round++) {
+        for (int slot = 0; slot < count; slot++) {
+            virtualPlants[slot]->update(deltaTimes[slot]);
+        }
+    }
+    double updates = static_cast<double>(count) * rounds;
+    double virtualNs = secondsSince(start) * 1e9 / updates;
+    KernelResult virtualResult = {"mixed", "virtual", virtualNs, 0.0};
+    results.kernel.push_back(virtualResult);
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "  GROWTH DISPATCH (" << count << " plants x " << rounds << " rounds)" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::left << std::setw(32) << "Path"
+              << std::right << std::setw(12) << "ns/plant" << std::setw(10) << "speedup"
+              << std::setw(12) << "max error" << std::endl;
+    std::cout << std::left << std::setw(32) << "Plant::update (virtual)"
+              << std::right << std::fixed << std::setprecision(3) << std::setw(12) << virtualNs
+              << std::setprecision(2) << std::setw(9) << 1.0 << "x" << std::setw(12) << "-" << std::endl;
+
+    // The whole batched path (gather, kernel, scatter, events) per ISA,
+    // so the kernel speedups above can be read end to end
+    const KernelIsa isas[] = {KernelIsa::SCALAR, KernelIsa::SSE2, KernelIsa::AVX2};
+    KernelIsa selected = PlantKernel::getIsa();
+    bool matches = true;
+    for (KernelIsa isa : isas) {
+        if (!PlantKernel::isSupported(isa)) {
+            continue;
+        }
+        PlantKernel::setIsa(isa);
+
+        PlantStore batchStore(count);
+        std::vector<Plant*> batchPlants(count);
+        fillDispatchStore(batchStore, batchPlants);
+
+        start = BenchClock::now();
+        for (int round = 0; round < rounds; round++) {
+            batchStore.advance(slots.data(), deltaTimes.data(), count);
+        }
+        double batchNs = secondsSince(start) * 1e9 / updates;
+
+        int stateMismatches = 0;
+        double maxError = compareStores(batchPlants, virtualPlants, stateMismatches);
+        if (maxError > KERNEL_TOLERANCE || stateMismatches != 0) {
+            matches = false;
+            std::cout << "❌ Batched " << PlantKernel::getIsaName(isa) << " path differs from Plant::update ("
+                      << stateMismatches << " plants in a different state)" << std::endl;
+        }
+
+        std::string isaName = PlantKernel::getIsaName(isa);
+        KernelResult batchResult = {"mixed", isaName + "-table", batchNs, maxError};
+        results.kernel.push_back(batchResult);
+
+        std::cout << std::left << std::setw(32) << "PlantStore::advance (" + isaName + ")"
+                  << std::right << std::fixed << std::setprecision(3) << std::setw(12) << batchNs
+                  << std::setprecision(2) << std::setw(9) << virtualNs / batchNs << "x"
+                  << std::scientific << std::setprecision(1) << std::setw(12) << maxError << std::endl;
+        std::cout << std::defaultfloat;
+    }
+    PlantKernel::setIsa(selected);
+
+    return matches;
+}
+
+// ============================================
+// CATALOG SELF-CHECKS
+// ============================================
+// Deterministic checks of the catalog's precomputed lookups against a
+// plain recomputation; fixed seeds, so a failure always reproduces
+
+// Demand picks per sampler check; at 10^6 draws one standard deviation
+// of a pick frequency is at most 0.0005
+const int DEMAND_SAMPLES = 1000000;
+const double DEMAND_TOLERANCE = 0.002;
+const uint64_t DEMAND_SEED = 20240917;
+
+// The built-in species with every other row's demand set to zero
+PlantCatalog createZeroDemandCatalog() {
+    std::vector<PlantTypeInfo> species = PlantTypeDatabase::catalog().getEntries();
+    for (size_t i = 1; i < species.size(); i += 2) {
+        species[i].demandProbability = 0.0f;
+    }
+    return PlantCatalog(std::move(species));
+}
+
+// Largest gap between each row's pick frequency and its share of the
+// total demand; zeroPicks counts draws of zero-demand rows
+double checkDemandSampler(const PlantCatalog& catalog, int& zeroPicks, double& nsPerSample) {
+    const std::vector<PlantTypeInfo>& entries = catalog.getEntries();
+    double totalDemand = 0.0;
+    for (const PlantTypeInfo& info : entries) {
+        totalDemand += info.demandProbability;
+    }
+
+    std::vector<int> picks(entries.size(), 0);
+    RandomStream random(DEMAND_SEED);
+    BenchClock::time_point start = BenchClock::now();
+    for (int i = 0; i < DEMAND_SAMPLES; i++) {
+        picks[catalog.getDemandSampler().sample(random)]++;
+    }
+    nsPerSample = secondsSince(start) * 1e9 / DEMAND_SAMPLES;
+
+    double maxError = 0.0;
+    zeroPicks = 0;
+    for (size_t row = 0; row < entries.size(); row++) {
+        if (entries[row].demandProbability == 0.0f) {
+            zeroPicks += picks[row];
+        }
+        double expected = entries[row].demandProbability / totalDemand;
+        double observed = static_cast<double>(picks[row]) / DEMAND_SAMPLES;
+        maxError = std::max(maxError, std::fabs(observed - expected));
+    }
+    return maxError;
+}
+
+// Generated catalog for the name index check: the most species a catalog
+// holds, with enough of them sharing one bucket that the index cannot be
+// placed in the usual two slots per name and has to double
+const int CROWDED_NAMES = 128;
+
+PlantCatalog createGeneratedCatalog() {
+    PlantTypeInfo templateInfo = PlantTypeDatabase::catalog().getEntries()[0];
+    std::vector<PlantTypeInfo> species(MAX_PLANT_TYPES, templateInfo);
+    for (int i = 0; i < MAX_PLANT_TYPES; i++) {
+        species[i].name = "Species " + std::to_string(i);
+    }
+
+    // Same size, so the same bucket count: use it to find colliding names
+    PlantCatalog plain(species);
+    int crowded = 0;
+    for (int candidate = 0; crowded < CROWDED_NAMES; candidate++) {
+        std::string name = "Crowded " + std::to_string(candidate);
+        if (plain.getNameBucket(name) == 0) {
+            species[crowded++].name = name;
+        }
+    }
+    return PlantCatalog(std::move(species));
+}
+
+// Looks up every name and near miss (last byte changed, one byte more or
+// less, case changed, the empty string, an unknown species) and counts
+// results that differ from a plain hash map of the catalog
+int checkNameIndex(const PlantCatalog& catalog, double& nsPerLookup) {
+    const std::vector<PlantTypeInfo>& entries = catalog.getEntries();
+    std::unordered_map<std::string, int> rows;
+    std::vector<std::string> probes = {"", "Mandrake"};
+    for (const PlantTypeInfo& info : entries) {
+        const std::string& name = info.name;
+        rows[name] = static_cast<int>(info.type);
+        probes.push_back(name);
+        for (int change : {1, -1, 0x20}) {
+            std::string nearMiss = name;
+            nearMiss.back() = static_cast<char>(change == 0x20 ? nearMiss.back() ^ change : nearMiss.back() + change);
+            probes.push_back(nearMiss);
+        }
+        probes.push_back(name + name.back());
+        probes.push_back(name.substr(0, name.size() - 1));
+    }
+
+    int mismatches = 0;
+    int known = 0;
+    for (const std::string& probe : probes) {
+        PlantType type = PlantType::BASIL;
+        bool found = catalog.findByName(probe, type);
+        std::unordered_map<std::string, int>::const_iterator row = rows.find(probe);
+        known += (row != rows.end()) ? 1 : 0;
+        if (found != (row != rows.end()) || (found && static_cast<int>(type) != row->second)) {
+            mismatches++;
+        }
+    }
+
+    const int rounds = 100;
+    int hits = 0;
+    BenchClock::time_point start = BenchClock::now();
+    for (int round = 0; round < rounds; round++) {
+        for (const std::string& probe : probes) {
+            PlantType type = PlantType::BASIL;
+            hits += catalog.findByName(probe, type) ? 1 : 0;
+        }
+    }
+    nsPerLookup = secondsSince(start) * 1e9 / (static_cast<double>(rounds) * probes.size());
+    if (hits != rounds * known) {
+        mismatches++;  // The timed lookups disagree with the checked ones
+    }
+    return mismatches;
+}
+
+// Returns false if a lookup disagrees with the recomputation
+bool benchCatalogChecks() {
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "  CATALOG SELF-CHECKS" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::left << std::setw(16) << "Check" << std::setw(14) << "Catalog"
+              << std::right << std::setw(9) << "species" << std::setw(12) << "ns/op"
+              << std::setw(12) << "max error" << std::endl;
+
+    const PlantCatalog& builtin = PlantTypeDatabase::catalog();
+    PlantCatalog zeroDemand = createZeroDemandCatalog();
+    struct DemandCase {
+        const char* name;
+        const PlantCatalog* catalog;
+    };
+    const DemandCase demandCases[] = {{"built-in", &builtin}, {"zero demand", &zeroDemand}};
+
+    bool matches = true;
+    for (const DemandCase& demandCase : demandCases) {
+        int zeroPicks = 0;
+        double nsPerSample = 0.0;
+        double maxError = checkDemandSampler(*demandCase.catalog, zeroPicks, nsPerSample);
+        std::cout << std::left << std::setw(16) << "demand sampler" << std::setw(14) << demandCase.name
+                  << std::right << std::setw(9) << demandCase.catalog->size()
+                  << std::fixed << std::setprecision(3) << std::setw(12) << nsPerSample
+                  << std::scientific << std::setprecision(1) << std::setw(12) << maxError << std::endl;
+        std::cout << std::defaultfloat;
+
+        if (maxError > DEMAND_TOLERANCE || zeroPicks != 0) {
+            matches = false;
+            std::cout << "❌ Demand sampler frequencies are off for the " << demandCase.name << " catalog ("
+                      << zeroPicks << " picks of zero-demand species)" << std::endl;
+        }
+    }
+
+    PlantCatalog generated = createGeneratedCatalog();
+    struct NameCase {
+        const char* name;
+        const PlantCatalog* catalog;
+        int minimumSlots;  // Generated: more than two per name, so the table doubled
+    };
+    const NameCase nameCases[] = {{"built-in", &builtin, 1}, {"generated", &generated, 2 * MAX_PLANT_TYPES + 1}};
+
+    std::cout << std::left << std::setw(16) << "Check" << std::setw(14) << "Catalog"
+              << std::right << std::setw(9) << "species" << std::setw(12) << "ns/op"
+              << std::setw(12) << "mismatches" << std::setw(8) << "slots" << std::endl;
+    for (const NameCase& nameCase : nameCases) {
+        double nsPerLookup = 0.0;
+        int mismatches = checkNameIndex(*nameCase.catalog, nsPerLookup);
+        int slots = nameCase.catalog->getNameSlotCount();
+        std::cout << std::left << std::setw(16) << "name index" << std::setw(14) << nameCase.name
+                  << std::right << std::setw(9) << nameCase.catalog->size()
+                  << std::fixed << std::setprecision(3) << std::setw(12) << nsPerLookup
+                  << std::setw(12) << mismatches << std::setw(8) << slots << std::endl;
+        std::cout << std::defaultfloat;
+
+        if (mismatches != 0) {
+            matches = false;
+            std::cout << "❌ Name index disagrees with the catalog rows on " << mismatches << " lookups ("
+                      << nameCase.name << " catalog)" << std::endl;
+        }
+        if (slots < nameCase.minimumSlots) {
+            matches = false;
+            std::cout << "❌ The " << nameCase.name << " catalog no longer forces the slot table to double"
+                      << std::endl;
+        }
+    }
+    return matches;
+}
+
+// ============================================
+// SCENARIO BENCHMARKS
+// ============================================
+
+// A started simulation with a basil seed on every tile
+Simulation* createFilledSimulation(const GridSize& grid, const BenchOptions& options) {
+    Simulation* simulation = new Simulation(grid.width, grid.height, options.threads);
+    simulation->initialize();
+
+    const PlantTypeInfo& info = PlantTypeDatabase::getInstance()->getPlantInfo(PlantType::BASIL);
+    simulation->setCurrency(simulation->getCurrency() +
+                            static_cast<double>(info.seedCost) * grid.width * grid.height);
+    for (int y = 0; y < grid.height; y++) {
+        for (int x = 0; x < grid.width; x++) {
+            simulation->plantSeed(PlantType::BASIL, x, y);
+        }
+    }
+    return simulation;
+}
+
+// Fast-forward steps over a full greenhouse
+ScenarioResult benchPlantUpdates(const GridSize& grid, const BenchOptions& options) {
+    long long tiles = static_cast<long long>(grid.width) * grid.height;
+    Simulation* simulation = createFilledSimulation(grid, options);
+
+    long long steps = scaledCount(20000000LL, tiles, 20, 20000);
+    BenchClock::time_point start = BenchClock::now();
+    for (long long i = 0; i < steps; i++) {
+        simulation->advance(Config::WARP_MAX_STEP_SECONDS);
+    }
+    ScenarioResult result = {"plant_update", grid, "tile-step", steps * tiles, secondsSince(start)};
+
+    delete simulation;
+    return result;
+}
+
+// Observer-driven task creation and assignment: one watering task per
+// tile per round, spread over one worker per 100 tiles
+ScenarioResult benchTaskAssignment(const GridSize& grid) {
+    int tiles = grid.width * grid.height;
+    int workerCount = std::max(1, std::min(1000, tiles / 100));
+
+    PlantStore store(tiles);
+    std::vector<Plant*> plants(tiles);
+    for (int slot = 0; slot < tiles; slot++) {
+        plants[slot] = store.create(slot, slot + 1, PlantType::BASIL, slot % grid.width, slot / grid.width);
+    }
+
+    WorkScheduler* scheduler = new WorkScheduler();
+    std::vector<Worker*> workers;
+    for (int i = 0; i < workerCount; i++) {
+        Worker* worker = new Worker(i + 1, "Bench " + std::to_string(i + 1));
+        worker->addRole(new WatererRole(worker));
+        workers.push_back(worker);
+        scheduler->registerWorker(worker);
+    }
+
+    long long rounds = scaledCount(100000LL, tiles, 1, 10000);
+    BenchClock::time_point start = BenchClock::now();
+    for (long long round = 0; round < rounds; round++) {
+        for (Plant* plant : plants) {
+            scheduler->onPlantNeedsWater(plant);
+        }
+        scheduler->processGlobalTasks();
+    }
+    ScenarioResult result = {"task_assignment", grid, "task", rounds * tiles, secondsSince(start)};
+
+    for (Worker* worker : workers) {
+        delete worker;  // Also deletes its queued tasks
+    }
+    delete scheduler;
+    return result;
+}
+
+// Inventory holds one item per tile (capped: addItem is linear, so
+// building is quadratic); lookups hit names spread over the whole list
+ScenarioResult benchInventoryLookup(const GridSize& grid) {
+    const int MAX_ITEMS = 10000;
+    int items = std::min(grid.width * grid.height, MAX_ITEMS);
+
+    Inventory inventory;
+    std::vector<std::string> names;
+    for (int i = 0; i < items; i++) {
+        names.push_back("Item " + std::to_string(i));
+        inventory.addItem(names.back(), "plant", 1, 10);
+    }
+
+    long long lookups = scaledCount(20000000LL, items, 1000, 1000000);
+    long long found = 0;
+    BenchClock::time_point start = BenchClock::now();
+    for (long long i = 0; i < lookups; i++) {
+        const std::string& name = names[static_cast<size_t>((i * 7919) % items)];
+        if (inventory.findItem(name) != nullptr) {
+            found++;
+        }
+    }
+    ScenarioResult result = {"inventory_lookup", grid, "lookup", lookups, secondsSince(start)};
+
+    if (found != lookups) {
+        std::cerr << "Inventory lookup missed " << (lookups - found) << " items" << std::endl;
+    }
+    return result;
+}
+
+// Memento round trip over a full greenhouse
+void benchSnapshots(const GridSize& grid, const BenchOptions& options, BenchResults& results) {
+    long long tiles = static_cast<long long>(grid.width) * grid.height;
+    Simulation* simulation = createFilledSimulation(grid, options);
+    long long repetitions = scaledCount(2000000LL, tiles, 3, 2000);
+
+    BenchClock::time_point start = BenchClock::now();
+    for (long long i = 0; i < repetitions; i++) {
+        simulation->createSnapshot();
+    }
+    ScenarioResult create = {"snapshot_create", grid, "snapshot", repetitions, secondsSince(start)};
+
+    start = BenchClock::now();
+    for (long long i = 0; i < repetitions; i++) {
+        simulation->restoreSnapshot(simulation->getSnapshotCount() - 1);
+    }
+    ScenarioResult restore = {"snapshot_restore", grid, "snapshot", repetitions, secondsSince(start)};
+
+    results.scenarios.push_back(create);
+    results.scenarios.push_back(restore);
+    delete simulation;
+}
+
+// One customer per tile (capped) waits a tick and is served; creation
+// (random seeding per customer) is not timed
+ScenarioResult benchCustomers(const GridSize& grid) {
+    const int MAX_CUSTOMERS = 100000;
+    int count = std::min(grid.width * grid.height, MAX_CUSTOMERS);
+    long long rounds = scaledCount(100000LL, count, 1, 10000);
+
+    double cash = Config::STARTING_MONEY;
+    double rating = Config::STARTING_RATING;
+    bool hasInventory = true;
+    ServeCustomerVisitor serveVisitor(cash, rating, hasInventory);
+    std::vector<Customer*> customers(count);
+
+    double seconds = 0.0;
+    for (long long round = 0; round < rounds; round++) {
+        for (Customer*& customer : customers) {
+            customer = CustomerFactory::createRandomCustomer();
+        }
+
+        BenchClock::time_point start = BenchClock::now();
+        for (Customer* customer : customers) {
+            customer->update(Config::SIM_TICK_SECONDS);
+            if (!customer->hasTimedOut()) {
+                customer->accept(&serveVisitor);
+            }
+        }
+        seconds += secondsSince(start);
+
+        for (Customer* customer : customers) {
+            delete customer;
+        }
+    }
+
+    ScenarioResult result = {"customer_processing", grid, "customer", rounds * count, seconds};
+    return result;
+}
+
+void benchScenarios(const BenchOptions& options, BenchResults& results) {
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "  SCENARIOS" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::left << std::setw(20) << "Benchmark" << std::setw(11) << "Grid"
+              << std::right << std::setw(14) << "ops" << std::setw(14) << "ns/op" << "  unit" << std::endl;
+
+    for (const GridSize& grid : options.grids) {
+        size_t first = results.scenarios.size();
+        results.scenarios.push_back(benchPlantUpdates(grid, options));
+        results.scenarios.push_back(benchTaskAssignment(grid));
+        results.scenarios.push_back(benchInventoryLookup(grid));
+        benchSnapshots(grid, options, results);
+        results.scenarios.push_back(benchCustomers(grid));
+
+        for (size_t i = first; i < results.scenarios.size(); i++) {
+            const ScenarioResult& result = results.scenarios[i];
+            std::string size = std::to_string(grid.width) + "x" + std::to_string(grid.height);
+            std::cout << std::left << std::setw(20) << result.name << std::setw(11) << size
+                      << std::right << std::setw(14) << result.operations
+                      << std::fixed << std::setprecision(1) << std::setw(14) << result.nsPerOperation()
+                      << "  " << result.unit << std::endl;
+        }
+    }
+}
+
+// ============================================
+// JSON OUTPUT
+// ============================================
+
+bool writeJson(const std::string& path, const BenchOptions& options, const BenchResults& results) {
+    std::ofstream out(path.c_str());
+    if (!out) {
+        return false;
+    }
+    out << std::setprecision(6);
+
+    out << "{\n  \"threads\": " << options.threads << ",\n  \"kernel\": [";
+    for (size_t i = 0; i < results.kernel.size(); i++) {
+        const KernelResult& result = results.kernel[i];
+        out << (i == 0 ? "\n" : ",\n")
+            << "    {\"state\": \"" << result.state << "\", \"isa\": \"" << result.isa
+            << "\", \"plants\": " << options.plants << ", \"ns_per_plant\": " << result.nsPerPlant
+            << ", \"max_error\": " << result.maxError << "}";
+    }
+    out << "\n  ],\n  \"scenarios\": [";
+    for (size_t i = 0; i < results.scenarios.size(); i++) {
+        const ScenarioResult& result = results.scenarios[i];
+        out << (i == 0 ? "\n" : ",\n")
+            << "    {\"name\": \"" << result.name << "\", \"width\": " << result.grid.width
+            << ", \"height\": " << result.grid.height
+            << ", \"tiles\": " << static_cast<long long>(result.grid.width) * result.grid.height
+            << ", \"unit\": \"" << result.unit << "\", \"operations\": " << result.operations
+            << ", \"seconds\": " << result.seconds << ", \"ns_per_op\": " << result.nsPerOperation() << "}";
+    }
+    out << "\n  ]\n}\n";
+    return static_cast<bool>(out);
+}
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    // Scenario code logs as it runs; keep timings free of console output
+    Logger::setLevel(LogLevel::OFF);
+
+    BenchResults results;
+    bool matches = true;
+    if (options.runKernel) {
+        matches = benchGrowthKernel(options, results);
+        matches = benchGrowthDispatch(options, results) && matches;
+        matches = benchCatalogChecks() && matches;
+    }
+    if (options.runScenarios) {
+        benchScenarios(options, results);
+    }
+
+    if (!options.jsonFile.empty()) {
+        if (!writeJson(options.jsonFile, options, results)) {
+            std::cerr << "Could not write " << options.jsonFile << std::endl;
+            return 1;
+        }
+        std::cout << "\nResults written to " << options.jsonFile << std::endl;
+    }
+
+    return matches ? 0 : 1;
+}
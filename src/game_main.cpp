@@ -1,7 +1,12 @@
 #include <iostream>
+#include <stdexcept>
+#include <string>
 #include "Core/GameManager.h"
+#include "Core/Logger.h"
+#include "Core/Config.h"
+#include "Greenhouse/PlantTypes.h"
 
-int main() {
+int main(int argc, char* argv[]) {
     std::cout << "\n";
     std::cout << "╔════════════════════════════════════════╗" << std::endl;
     std::cout << "║                                        ║" << std::endl;
@@ -12,13 +17,37 @@ int main() {
     std::cout << "\nInitializing game..." << std::endl;
     
     try {
+        // The catalog has to be in place before the greenhouse is built
+        PlantTypeDatabase* plantTypes = PlantTypeDatabase::getInstance();
+        bool recording = false;
+        for (int i = 1; i + 1 < argc; i++) {
+            std::string arg = argv[i];
+            if (arg == "--catalog" && !plantTypes->loadCatalog(argv[i + 1])) {
+                throw std::runtime_error(std::string("Could not load plant catalog ") + argv[i + 1]);
+            }
+            recording = recording || arg == "--record";
+        }
+        
+        // Recorded sessions must replay with the catalog they started with
+        if (!plantTypes->getCatalogPath().empty() && !recording) {
+            plantTypes->startWatching(Config::CATALOG_WATCH_INTERVAL_SECONDS);
+        }
+        
         GameManager game;
+        for (int i = 1; i + 1 < argc; i++) {
+            if (std::string(argv[i]) == "--record") {
+                game.recordSessionTo(argv[++i]);
+            }
+        }
         game.run();
+        plantTypes->stopWatching();
     } catch (const std::exception& e) {
+        Logger::getInstance()->flush();
         std::cerr << "Error: " << e.what() << std::endl;
         return 1;
     }
     
+    Logger::getInstance()->flush();
     std::cout << "\nThanks for playing! 👋" << std::endl;
     
     return 0;
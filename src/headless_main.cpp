@@ -0,0 +1,692 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <fstream>
+#include <cstdlib>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "Core/Simulation.h"
+#include "Core/Logger.h"
+#include "Core/FrameProfiler.h"
+#include "Core/FrameBudget.h"
+#include "Core/Tracer.h"
+#include "Core/AllocationTracker.h"
+#include "Core/Metrics.h"
+#include "Core/SessionLog.h"
+#include "Core/LiveCount.h"
+#include "Patterns/Command/Command.h"
+#include "Patterns/Memento/GameMemento.h"
+#include "Patterns/Observer/PlantSubject.h"
+#include "Customer/Customer.h"
+#include "Staff/Worker.h"
+#include "Greenhouse/PlantTypes.h"
+
+// ============================================
+// HEADLESS DRIVER
+// ============================================
+// Runs the simulation without a window, ticking update() as fast as
+// possible and reporting throughput. Used for soak runs and capacity tests.
+
+struct HeadlessOptions {
+    long long ticks;
+    float deltaTime;     // Seconds of simulated time per tick
+    int gridWidth;
+    int gridHeight;
+    bool gridGiven;      // --grid was passed (a soak otherwise uses its own default)
+    bool fillGrid;       // Plant a seed on every tile before running
+    float warpFactor;    // Game seconds per tick second
+    float days;          // Fast-forward this many game days instead of ticking
+    int threads;         // Plant update threads (0 = all cores)
+    LogLevel logLevel;   // Runtime log filter
+    std::string profileCsv;  // Write per-phase frame percentiles here
+    std::string traceFile;   // Write a Chrome trace of the run here
+    int traceEvents;         // Trace buffer size
+    bool allocationStats;    // Count heap allocations per tick and phase
+    std::string metricsFile;    // Publish Prometheus text here
+    std::string metricsSocket;  // ...and/or serve it on this UNIX socket
+    double metricsInterval;     // Seconds between publishes
+    double frameBudgetMs;       // Per-tick budget for deferrable work (0 = off)
+    std::string recordFile;     // Record the session log here
+    std::string replayFile;     // Replay this session log instead of ticking
+    uint64_t seed;              // Session seed
+    int soakDays;               // Soak run length in game days (0 = no soak)
+    int soakWarmupDays;         // The sample at the end of this day is the baseline
+    double soakMaxRssGrowth;    // Percent over the baseline sample
+    double soakMaxLatencyDrift; // Percent over the baseline median tick
+    long long soakMaxObjectGrowth;  // Live instances over the baseline, per type
+    std::string catalogFile;    // Plant catalog to load instead of the built-in one
+    bool catalogWatch;          // Reload the catalog when its file changes
+    std::string catalogExport;  // Write the catalog here and exit
+
+    HeadlessOptions() : ticks(10000), deltaTime(Config::SIM_TICK_SECONDS),
+                        gridWidth(Config::INITIAL_GRID_WIDTH),
+                        gridHeight(Config::INITIAL_GRID_HEIGHT), gridGiven(false),
+                        fillGrid(false), warpFactor(1.0f), days(0.0f),
+                        threads(Config::SIM_WORKER_THREADS), logLevel(LogLevel::INFO),
+                        traceEvents(Config::TRACE_MAX_EVENTS), allocationStats(false),
+                        metricsInterval(Config::METRICS_INTERVAL_SECONDS), frameBudgetMs(0.0),
+                        seed(Config::SIM_DEFAULT_SEED), soakDays(0),
+                        soakWarmupDays(Config::SOAK_WARMUP_DAYS),
+                        soakMaxRssGrowth(Config::SOAK_MAX_RSS_GROWTH_PERCENT),
+                        soakMaxLatencyDrift(Config::SOAK_MAX_LATENCY_DRIFT_PERCENT),
+                        soakMaxObjectGrowth(Config::SOAK_MAX_OBJECT_GROWTH), catalogWatch(false) {}
+};
+
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --ticks N       Number of update() ticks to run (default 10000)\n"
+              << "  --dt SECONDS    Simulated seconds per tick (default " << Config::SIM_TICK_SECONDS << ")\n"
+              << "  --grid WxH      Greenhouse size (default "
+              << Config::INITIAL_GRID_WIDTH << "x" << Config::INITIAL_GRID_HEIGHT << ", "
+              << Config::SOAK_GRID_WIDTH << "x" << Config::SOAK_GRID_HEIGHT << " with --soak)\n"
+              << "  --fill          Plant a seed on every tile before running\n"
+              << "  --warp FACTOR   Time warp applied to each tick (default 1, max "
+              << Config::MAX_WARP_FACTOR << ")\n"
+              << "  --days N        Fast-forward N game days in batched steps (ignores --ticks)\n"
+              << "  --threads N     Plant update threads (default 0 = all cores)\n"
+              << "  --log-level L   debug, info, warn, error or off (default info)\n"
+              << "  --profile-csv F Write per-phase tick percentiles to CSV file F\n"
+              << "  --trace F       Write a Chrome trace (ticks and task lifecycles) to F\n"
+              << "  --trace-events N  Trace buffer size in events (default " << Config::TRACE_MAX_EVENTS << ")\n"
+              << "  --alloc-stats   Count heap allocations per tick and phase\n"
+              << "  --metrics F     Publish Prometheus metrics to file F\n"
+              << "  --metrics-socket P  Serve Prometheus metrics on UNIX socket P\n"
+              << "  --metrics-interval S  Seconds between metric publishes (default "
+              << Config::METRICS_INTERVAL_SECONDS << ")\n"
+              << "  --frame-budget MS  Defer snapshot serialization, backlog draining and metrics\n"
+              << "                  once a tick has used MS milliseconds (default off; ignored\n"
+              << "                  with --record/--replay)\n"
+              << "  --seed N        Session seed (default " << Config::SIM_DEFAULT_SEED << ")\n"
+              << "  --record F      Record actions and ticks to session log F\n"
+              << "  --replay F      Replay session log F (grid and seed come from the log)\n"
+              << "  --soak [DAYS]   Soak run: tend a full grid for DAYS game days (default "
+              << Config::SOAK_DEFAULT_DAYS << "),\n"
+              << "                  sampling memory, live objects and tick latency each day\n"
+              << "  --soak-warmup DAYS  Baseline is the end of day DAYS (default "
+              << Config::SOAK_WARMUP_DAYS << ")\n"
+              << "  --soak-max-rss-growth PCT  Fail if RSS grows more than PCT (default "
+              << Config::SOAK_MAX_RSS_GROWTH_PERCENT << ")\n"
+              << "  --soak-max-latency-drift PCT  Fail if the median tick slows more than PCT (default "
+              << Config::SOAK_MAX_LATENCY_DRIFT_PERCENT << ")\n"
+              << "  --soak-max-object-growth N  Fail if any object type grows by more than N (default "
+              << Config::SOAK_MAX_OBJECT_GROWTH << ")\n"
+              << "  --catalog F     Load plant species from catalog F (text or binary; replays\n"
+              << "                  need the catalog they were recorded with)\n"
+              << "  --catalog-watch Reload the catalog when its file changes (ignored with\n"
+              << "                  --record/--replay)\n"
+              << "  --catalog-export F  Write the catalog to F (binary if F ends in .bin) and exit\n"
+              << "  --help          Show this message" << std::endl;
+}
+
+bool parseGrid(const std::string& value, int& width, int& height) {
+    size_t sep = value.find('x');
+    if (sep == std::string::npos) {
+        return false;
+    }
+
+    width = std::atoi(value.substr(0, sep).c_str());
+    height = std::atoi(value.substr(sep + 1).c_str());
+    return width > 0 && height > 0;
+}
+
+bool parseOptions(int argc, char* argv[], HeadlessOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+
+        if (arg == "--ticks" && hasValue) {
+            options.ticks = std::atoll(argv[++i]);
+        } else if (arg == "--dt" && hasValue) {
+            options.deltaTime = static_cast<float>(std::atof(argv[++i]));
+        } else if (arg == "--grid" && hasValue) {
+            if (!parseGrid(argv[++i], options.gridWidth, options.gridHeight)) {
+                std::cerr << "Invalid grid size: " << argv[i] << std::endl;
+                return false;
+            }
+            options.gridGiven = true;
+        } else if (arg == "--warp" && hasValue) {
+            options.warpFactor = static_cast<float>(std::atof(argv[++i]));
+        } else if (arg == "--days" && hasValue) {
+            options.days = static_cast<float>(std::atof(argv[++i]));
+        } else if (arg == "--threads" && hasValue) {
+            options.threads = std::atoi(argv[++i]);
+        } else if (arg == "--log-level" && hasValue) {
+            if (!Logger::parseLevel(argv[++i], options.logLevel)) {
+                std::cerr << "Invalid log level: " << argv[i] << std::endl;
+                return false;
+            }
+        } else if (arg == "--profile-csv" && hasValue) {
+            options.profileCsv = argv[++i];
+        } else if (arg == "--trace" && hasValue) {
+            options.traceFile = argv[++i];
+        } else if (arg == "--trace-events" && hasValue) {
+            options.traceEvents = std::atoi(argv[++i]);
+        } else if (arg == "--alloc-stats") {
+            options.allocationStats = true;
+        } else if (arg == "--metrics" && hasValue) {
+            options.metricsFile = argv[++i];
+        } else if (arg == "--metrics-socket" && hasValue) {
+            options.metricsSocket = argv[++i];
+        } else if (arg == "--frame-budget" && hasValue) {
+            options.frameBudgetMs = std::atof(argv[++i]);
+        } else if (arg == "--metrics-interval" && hasValue) {
+            options.metricsInterval = std::atof(argv[++i]);
+        } else if (arg == "--seed" && hasValue) {
+            options.seed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--record" && hasValue) {
+            options.recordFile = argv[++i];
+        } else if (arg == "--replay" && hasValue) {
+            options.replayFile = argv[++i];
+        } else if (arg == "--soak") {
+            // Day count is optional
+            options.soakDays = Config::SOAK_DEFAULT_DAYS;
+            if (hasValue && argv[i + 1][0] != '-') {
+                options.soakDays = std::atoi(argv[++i]);
+            }
+            options.fillGrid = true;
+        } else if (arg == "--soak-warmup" && hasValue) {
+            options.soakWarmupDays = std::atoi(argv[++i]);
+        } else if (arg == "--soak-max-rss-growth" && hasValue) {
+            options.soakMaxRssGrowth = std::atof(argv[++i]);
+        } else if (arg == "--soak-max-latency-drift" && hasValue) {
+            options.soakMaxLatencyDrift = std::atof(argv[++i]);
+        } else if (arg == "--soak-max-object-growth" && hasValue) {
+            options.soakMaxObjectGrowth = std::atoll(argv[++i]);
+        } else if (arg == "--catalog" && hasValue) {
+            options.catalogFile = argv[++i];
+        } else if (arg == "--catalog-watch") {
+            options.catalogWatch = true;
+        } else if (arg == "--catalog-export" && hasValue) {
+            options.catalogExport = argv[++i];
+        } else if (arg == "--fill") {
+            options.fillGrid = true;
+        } else {
+            printUsage(argv[0]);
+            return false;
+        }
+    }
+
+    // A soak on the game's starting greenhouse would say little about leaks
+    if (options.soakDays > 0 && !options.gridGiven) {
+        options.gridWidth = Config::SOAK_GRID_WIDTH;
+        options.gridHeight = Config::SOAK_GRID_HEIGHT;
+    }
+
+    return options.ticks > 0 && options.deltaTime > 0.0f && options.warpFactor >= 0.0f &&
+           options.threads >= 0 && options.traceEvents > 0 && options.metricsInterval > 0.0 &&
+           options.soakDays >= 0 && options.soakWarmupDays >= 1 && options.frameBudgetMs >= 0.0;
+}
+
+// One tick or fast-forward step as a profiler frame, then any due metrics
+// (left due for a later frame if the step used up the frame budget)
+template <typename StepFunction>
+void runFrame(Simulation& simulation, FrameProfiler* profiler, MetricsRegistry* metrics, StepFunction step) {
+    FrameBudget* budget = FrameBudget::getInstance();
+    budget->beginFrame();
+    profiler->beginFrame();
+    {
+        FrameProfiler::Scope frameScope(ProfilePhase::FRAME);
+        FrameProfiler::Scope scope(ProfilePhase::UPDATE);
+        step();
+    }
+    profiler->endFrame();
+    if (metrics->isDue()) {
+        if (budget->isExhausted()) {
+            budget->noteDeferred();
+        } else {
+            simulation.collectMetrics(metrics);
+            metrics->publish();
+        }
+    }
+    budget->endFrame();
+}
+
+// Feed a session log back through the simulation; ticks and fast-forward
+// steps are profiler frames like a live run. Returns the ticks replayed.
+long long replaySession(Simulation& simulation, SessionReader& reader,
+                        FrameProfiler* profiler, MetricsRegistry* metrics) {
+    long long ticks = 0;
+    SessionEvent event;
+    while (reader.next(event)) {
+        if (event.op == SessionOp::TICK) {
+            for (uint32_t i = 0; i < event.count; i++) {
+                runFrame(simulation, profiler, metrics, [&]() { simulation.update(event.seconds); });
+            }
+            ticks += event.count;
+        } else if (event.op == SessionOp::ADVANCE) {
+            runFrame(simulation, profiler, metrics, [&]() { simulation.applySessionEvent(event); });
+        } else {
+            simulation.applySessionEvent(event);
+        }
+    }
+    return ticks;
+}
+
+// ============================================
+// SOAK RUN
+// ============================================
+// Fast-forwards day by day over a full grid, replanting and harvesting
+// at each day end like a player would, so plants, subjects and tasks keep
+// being created and destroyed. One sample per game day; the sample at the
+// end of the warm-up (once start-up allocations and the snapshot history
+// have settled) is the baseline.
+
+struct SoakSample {
+    int day;
+    double residentBytes;      // -1 where unavailable
+    long long plants;
+    long long commands;
+    long long customers;
+    long long workers;
+    long long plantSubjects;
+    long long mementos;
+    double tickP50Ms;
+    double tickP99Ms;
+};
+
+// Live object types checked against --soak-max-object-growth
+struct SoakObjectColumn {
+    const char* name;
+    long long SoakSample::*count;
+};
+
+const SoakObjectColumn SOAK_OBJECT_COLUMNS[] = {
+    {"plants", &SoakSample::plants},
+    {"commands", &SoakSample::commands},
+    {"customers", &SoakSample::customers},
+    {"workers", &SoakSample::workers},
+    {"plant_subjects", &SoakSample::plantSubjects},
+    {"mementos", &SoakSample::mementos},
+};
+
+double percentile(std::vector<double>& values, double fraction) {
+    if (values.empty()) {
+        return 0.0;
+    }
+    size_t rank = static_cast<size_t>(fraction * (values.size() - 1) + 0.5);
+    std::nth_element(values.begin(), values.begin() + rank, values.end());
+    return values[rank];
+}
+
+// Harvest what is ready, replant empty tiles and water the rest
+void tendGrid(Simulation& simulation) {
+    const PlantTypeInfo& info = PlantTypeDatabase::getInstance()->getPlantInfo(PlantType::BASIL);
+    int width = simulation.getGreenhouseWidth();
+    int height = simulation.getGreenhouseHeight();
+
+    // Seeds for a full replant are never the limiting factor
+    double seedBudget = static_cast<double>(info.seedCost) * width * height;
+    if (simulation.getCurrency() < seedBudget) {
+        simulation.setCurrency(seedBudget);
+    }
+
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            Plant* plant = simulation.syncPlantAt(x, y);
+            if (plant != nullptr && plant->canHarvest()) {
+                simulation.harvestPlant(x, y);
+                plant = nullptr;
+            }
+            if (plant == nullptr) {
+                simulation.plantSeed(PlantType::BASIL, x, y);
+            } else if (plant->getStateId() != PlantStateId::DEAD) {
+                simulation.waterPlant(x, y);
+            }
+        }
+    }
+}
+
+void runSoak(Simulation& simulation, const HeadlessOptions& options, FrameProfiler* profiler,
+             MetricsRegistry* metrics, std::vector<SoakSample>& samples) {
+    const double daySeconds = static_cast<double>(Config::HOURS_PER_DAY) * Config::MINUTES_PER_HOUR *
+                              Config::REAL_SECONDS_PER_GAME_MINUTE;
+    std::vector<double> tickMs;
+
+    for (int day = 1; day <= options.soakDays; day++) {
+        tickMs.clear();
+        double remaining = daySeconds;
+        while (remaining > 0.0) {
+            float span = static_cast<float>(std::min(remaining, static_cast<double>(Config::WARP_MAX_STEP_SECONDS)));
+            auto tickStart = std::chrono::steady_clock::now();
+            runFrame(simulation, profiler, metrics, [&]() { simulation.advance(span); });
+            std::chrono::duration<double, std::milli> tickTime = std::chrono::steady_clock::now() - tickStart;
+            tickMs.push_back(tickTime.count());
+            remaining -= span;
+        }
+        tendGrid(simulation);
+
+        SoakSample sample;
+        sample.day = day;
+        sample.residentBytes = MetricsRegistry::getResidentBytes();
+        sample.plants = simulation.getPlantCount();
+        sample.commands = LiveCount<Command>::getLiveCount();
+        sample.customers = LiveCount<Customer>::getLiveCount();
+        sample.workers = LiveCount<Worker>::getLiveCount();
+        sample.plantSubjects = LiveCount<PlantSubject>::getLiveCount();
+        sample.mementos = LiveCount<GameMemento>::getLiveCount();
+        sample.tickP50Ms = percentile(tickMs, 0.50);
+        sample.tickP99Ms = percentile(tickMs, 0.99);
+        samples.push_back(sample);
+
+        LOG_INFO(SIM, "🧪 Soak day " << day << "/" << options.soakDays << ": "
+                 << static_cast<long long>(sample.residentBytes / 1024.0) << " KB resident, "
+                 << sample.commands << " commands, median tick " << sample.tickP50Ms << " ms");
+    }
+}
+
+// Prints the samples and checks the last one against the baseline;
+// returns false if any limit is exceeded
+bool reportSoak(const std::vector<SoakSample>& samples, const HeadlessOptions& options) {
+    std::cout << "\nSoak samples (one per game day):" << std::endl;
+    std::cout << "day,rss_kb";
+    for (const SoakObjectColumn& column : SOAK_OBJECT_COLUMNS) {
+        std::cout << "," << column.name;
+    }
+    std::cout << ",tick_p50_ms,tick_p99_ms" << std::endl;
+    for (const SoakSample& sample : samples) {
+        std::cout << sample.day << "," << static_cast<long long>(sample.residentBytes / 1024.0);
+        for (const SoakObjectColumn& column : SOAK_OBJECT_COLUMNS) {
+            std::cout << "," << sample.*column.count;
+        }
+        std::cout << std::setprecision(3) << "," << sample.tickP50Ms << "," << sample.tickP99Ms << std::endl;
+    }
+
+    if (static_cast<int>(samples.size()) <= options.soakWarmupDays) {
+        std::cout << "⚠️  Soak needs more than " << options.soakWarmupDays
+                  << " days (the warm-up) to measure drift" << std::endl;
+        return true;
+    }
+
+    const SoakSample& baseline = samples[options.soakWarmupDays - 1];
+    const SoakSample& last = samples.back();
+    bool passed = true;
+
+    std::cout << std::setprecision(1);
+    if (baseline.residentBytes > 0.0 && last.residentBytes >= 0.0) {
+        double growth = (last.residentBytes / baseline.residentBytes - 1.0) * 100.0;
+        bool ok = growth <= options.soakMaxRssGrowth;
+        std::cout << (ok ? "✅" : "❌") << " RSS growth: " << growth << "% (limit "
+                  << options.soakMaxRssGrowth << "%)" << std::endl;
+        passed = passed && ok;
+    }
+
+    if (baseline.tickP50Ms > 0.0) {
+        double drift = (last.tickP50Ms / baseline.tickP50Ms - 1.0) * 100.0;
+        bool ok = drift <= options.soakMaxLatencyDrift;
+        std::cout << (ok ? "✅" : "❌") << " Median tick drift: " << drift << "% (limit "
+                  << options.soakMaxLatencyDrift << "%)" << std::endl;
+        passed = passed && ok;
+    }
+
+    for (const SoakObjectColumn& column : SOAK_OBJECT_COLUMNS) {
+        long long growth = last.*column.count - baseline.*column.count;
+        if (growth > options.soakMaxObjectGrowth) {
+            std::cout << "❌ Live " << column.name << " grew by " << growth << " (limit "
+                      << options.soakMaxObjectGrowth << ")" << std::endl;
+            passed = false;
+        }
+    }
+
+    std::cout << (passed ? "✅ Soak passed" : "❌ Soak failed") << std::endl;
+    return passed;
+}
+
+int main(int argc, char* argv[]) {
+    HeadlessOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    Logger::setLevel(options.logLevel);
+
+    PlantTypeDatabase* plantTypes = PlantTypeDatabase::getInstance();
+    if (!options.catalogFile.empty() && !plantTypes->loadCatalog(options.catalogFile)) {
+        Logger::getInstance()->flush();
+        std::cerr << "Could not load plant catalog " << options.catalogFile << std::endl;
+        return 1;
+    }
+    if (!options.catalogExport.empty()) {
+        const std::string& path = options.catalogExport;
+        bool binary = path.size() >= 4 && path.compare(path.size() - 4, 4, ".bin") == 0;
+        if (!plantTypes->saveCatalog(path, binary)) {
+            std::cerr << "Could not write " << path << std::endl;
+            return 1;
+        }
+        std::cout << "Wrote " << PlantTypeDatabase::getPlantTypeCount() << " species to " << path << std::endl;
+        return 0;
+    }
+
+    try {
+        SessionReader reader;
+        bool replaying = !options.replayFile.empty();
+        if (replaying) {
+            if (!reader.open(options.replayFile)) {
+                std::cerr << "Could not read session log " << options.replayFile << std::endl;
+                return 1;
+            }
+            options.gridWidth = reader.getWidth();
+            options.gridHeight = reader.getHeight();
+            options.seed = reader.getSeed();
+        }
+
+        Simulation simulation(options.gridWidth, options.gridHeight, options.threads);
+        simulation.setSeed(options.seed);
+        simulation.initialize();
+
+        // Everything after initialize() goes into the log
+        SessionRecorder recorder;
+        if (!options.recordFile.empty()) {
+            if (!recorder.open(options.recordFile, options.gridWidth, options.gridHeight, options.seed)) {
+                std::cerr << "Could not write " << options.recordFile << std::endl;
+                return 1;
+            }
+            simulation.setRecorder(&recorder);
+        }
+
+        if (options.fillGrid && !replaying) {
+            // Headless capacity runs are not limited by the starting balance
+            const PlantTypeInfo& info = PlantTypeDatabase::getInstance()->getPlantInfo(PlantType::BASIL);
+            simulation.setCurrency(simulation.getCurrency() +
+                                   static_cast<double>(info.seedCost) * options.gridWidth * options.gridHeight);
+
+            for (int y = 0; y < options.gridHeight; y++) {
+                for (int x = 0; x < options.gridWidth; x++) {
+                    simulation.plantSeed(PlantType::BASIL, x, y);
+                }
+            }
+        }
+
+        if (!replaying) {
+            simulation.setWarpFactor(options.warpFactor);
+        }
+
+        // Wall-time dependent deferral would break replays
+        if (options.frameBudgetMs > 0.0 && (replaying || !options.recordFile.empty())) {
+            std::cerr << "--frame-budget is ignored with --record/--replay" << std::endl;
+        } else {
+            FrameBudget::getInstance()->setBudgetMs(options.frameBudgetMs);
+        }
+
+        // ...and so would a catalog changing mid-run
+        if (options.catalogWatch && (replaying || !options.recordFile.empty())) {
+            std::cerr << "--catalog-watch is ignored with --record/--replay" << std::endl;
+        } else if (options.catalogWatch) {
+            plantTypes->startWatching(Config::CATALOG_WATCH_INTERVAL_SECONDS);
+        }
+
+        // Each tick (or fast-forward step) is one profiler frame
+        if (options.allocationStats) {
+            if (!AllocationTracker::isAvailable()) {
+                std::cerr << "Built without TEMPLANTER_ALLOC_HOOK; --alloc-stats ignored" << std::endl;
+            }
+            AllocationTracker::setEnabled(true);
+            AllocationTracker::reset();
+        }
+
+        FrameProfiler* profiler = FrameProfiler::getInstance();
+        profiler->reset();
+        if (!options.traceFile.empty()) {
+            Tracer::getInstance()->start(static_cast<size_t>(options.traceEvents));
+        }
+
+        MetricsRegistry* metrics = MetricsRegistry::getInstance();
+        metrics->setInterval(options.metricsInterval);
+        if (!options.metricsFile.empty() && !metrics->openFile(options.metricsFile)) {
+            std::cerr << "Could not write " << options.metricsFile << std::endl;
+            return 1;
+        }
+        if (!options.metricsSocket.empty() && !metrics->openSocket(options.metricsSocket)) {
+            std::cerr << "Could not listen on " << options.metricsSocket << std::endl;
+            return 1;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        std::vector<SoakSample> soakSamples;
+
+        if (replaying) {
+            options.ticks = replaySession(simulation, reader, profiler, metrics);
+        } else if (options.soakDays > 0) {
+            runSoak(simulation, options, profiler, metrics, soakSamples);
+            options.ticks = 0;
+        } else if (options.days > 0.0f) {
+            double gameSeconds = static_cast<double>(options.days) * Config::HOURS_PER_DAY *
+                                 Config::MINUTES_PER_HOUR * Config::REAL_SECONDS_PER_GAME_MINUTE;
+            double remaining = gameSeconds;
+            while (remaining > 0.0) {
+                // Same float steps Simulation::advance would take
+                float span = static_cast<float>(std::min(remaining, static_cast<double>(Config::WARP_MAX_STEP_SECONDS)));
+                runFrame(simulation, profiler, metrics, [&]() { simulation.advance(span); });
+                remaining -= span;
+            }
+            options.ticks = 0;
+        } else {
+            for (long long tick = 0; tick < options.ticks; tick++) {
+                runFrame(simulation, profiler, metrics, [&]() { simulation.update(options.deltaTime); });
+            }
+        }
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        Tracer::getInstance()->stop();
+        plantTypes->stopWatching();
+        uint64_t stateHash = simulation.getStateHash();
+        simulation.setRecorder(nullptr);
+        recorder.close(stateHash);
+        if (metrics->isOpen()) {
+            simulation.collectMetrics(metrics);  // Final values for the scraper
+            metrics->publish();
+        }
+        AllocationTracker::Counts allocations = AllocationTracker::getTotal();
+        AllocationTracker::setEnabled(false);
+        double seconds = elapsed.count();
+        double ticksPerSecond = seconds > 0.0 ? options.ticks / seconds : 0.0;
+
+        TimeManager* timeManager = simulation.getTimeManager();
+        Logger::getInstance()->flush();  // Keep the report after the run's log lines
+
+        std::cout << "\n========================================" << std::endl;
+        std::cout << "  HEADLESS RUN COMPLETE" << std::endl;
+        std::cout << "========================================" << std::endl;
+        std::cout << "Grid: " << options.gridWidth << "x" << options.gridHeight << std::endl;
+        std::cout << "Threads: " << simulation.getWorkerThreadCount() << std::endl;
+        std::cout << "Plant store: " << PlantStore::getBytesPerSlot() << " bytes/tile" << std::endl;
+        if (replaying) {
+            std::cout << "Replay: " << options.replayFile << " (" << options.ticks << " ticks, seed "
+                      << options.seed << ")" << std::endl;
+        } else if (options.soakDays > 0) {
+            std::cout << "Soak: " << options.soakDays << " game days" << std::endl;
+        } else if (options.days > 0.0f) {
+            std::cout << "Fast-forward: " << options.days << " game days" << std::endl;
+        } else {
+            std::cout << "Ticks: " << options.ticks << " (dt " << options.deltaTime
+                      << "s, warp x" << options.warpFactor << ")" << std::endl;
+        }
+        std::cout << "Wall time: " << std::fixed << std::setprecision(3) << seconds << "s" << std::endl;
+        if (options.ticks > 0) {
+            std::cout << "Ticks/second: " << std::setprecision(1) << ticksPerSecond << std::endl;
+        }
+        std::cout << "Game time: Day " << timeManager->getCurrentDay()
+                  << " " << timeManager->getTimeString() << std::endl;
+        std::cout << "Money: $" << std::setprecision(2) << simulation.getCurrency() << std::endl;
+        std::cout << "State hash: " << std::hex << std::setw(16) << std::setfill('0') << stateHash
+                  << std::dec << std::setfill(' ') << std::endl;
+        bool replayMatches = true;
+        if (replaying) {
+            replayMatches = reader.hasEnded() && reader.getRecordedHash() == stateHash;
+            if (!reader.hasEnded()) {
+                std::cout << "❌ Session log has no end record (truncated or unknown record)" << std::endl;
+            } else if (replayMatches) {
+                std::cout << "✅ Replay matches the recorded state" << std::endl;
+            } else {
+                std::cout << "❌ Replay diverged: recorded hash " << std::hex << std::setw(16) << std::setfill('0')
+                          << reader.getRecordedHash() << std::dec << std::setfill(' ') << std::endl;
+            }
+        }
+        if (!options.recordFile.empty()) {
+            std::cout << "Session recorded to " << options.recordFile << " (" << recorder.getRecordCount()
+                      << " records)" << std::endl;
+        }
+        FrameBudget* budget = FrameBudget::getInstance();
+        if (budget->isEnabled()) {
+            std::cout << "Frame budget: " << std::setprecision(2) << budget->getBudgetMs() << " ms ("
+                      << budget->getOverrunFrames() << " ticks over, " << budget->getDeferredFrames()
+                      << " deferred work)" << std::endl;
+        }
+        if (Logger::getInstance()->getDroppedCount() > 0) {
+            std::cout << "Log lines dropped: " << Logger::getInstance()->getDroppedCount() << std::endl;
+        }
+
+        if (options.allocationStats && profiler->getFrameCount() > 0) {
+            double frames = static_cast<double>(profiler->getFrameCount());
+            std::cout << "Heap allocations: " << allocations.allocations << " ("
+                      << std::setprecision(1) << allocations.allocations / frames << "/tick, "
+                      << allocations.bytes / frames << " bytes/tick)" << std::endl;
+        }
+
+        std::cout << "\nPhase timings (last " << FrameProfiler::getInstance()->getStats(ProfilePhase::FRAME).samples
+                  << " frames):" << std::endl;
+        FrameProfiler::getInstance()->writeCsv(std::cout);
+
+        if (!options.profileCsv.empty()) {
+            std::ofstream csv(options.profileCsv.c_str());
+            if (!csv) {
+                std::cerr << "Could not write " << options.profileCsv << std::endl;
+                return 1;
+            }
+            FrameProfiler::getInstance()->writeCsv(csv);
+            std::cout << "Profile written to " << options.profileCsv << std::endl;
+        }
+
+        if (!options.traceFile.empty()) {
+            Tracer* tracer = Tracer::getInstance();
+            if (!tracer->save(options.traceFile)) {
+                std::cerr << "Could not write " << options.traceFile << std::endl;
+                return 1;
+            }
+            std::cout << "Trace written to " << options.traceFile << " (" << tracer->getEventCount()
+                      << " events, " << tracer->getDroppedCount() << " dropped)" << std::endl;
+        }
+
+        bool soakPassed = true;
+        if (options.soakDays > 0) {
+            soakPassed = reportSoak(soakSamples, options);
+        }
+
+        if (metrics->isOpen()) {
+            MetricsRegistry::destroyInstance();  // Stops the socket thread and removes the socket
+        }
+
+        if (!replayMatches) {
+            return 2;
+        }
+        if (!soakPassed) {
+            return 3;
+        }
+    } catch (const std::exception& e) {
+        Logger::getInstance()->flush();
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -106,14 +106,13 @@ bool testPlantSystem() {
     const PlantTypeInfo& basilInfo = db->getPlantInfo(PlantType::BASIL);
     bool hasBasil = (basilInfo.name == "Basil");
     
-    Plant* tomato = new Plant(1, PlantType::TOMATO, 0, 0);
+    PlantStore store(1);
+    Plant* tomato = store.create(0, 1, PlantType::TOMATO, 0, 0);
     bool plantCreated = (tomato != nullptr);
     
     printTestResult("Plant database loaded", hasBasil);
     printTestResult("Plant created", plantCreated);
     
-    delete tomato;
-    
     std::cout << "\n✓ Plant system tests completed!" << std::endl;
     return hasBasil && plantCreated;
 }
@@ -142,7 +141,8 @@ bool testWorkerSystem() {
     printTestResult("Decorator Pattern - Harvester role", hasHarvester);
     
     // Test 3: Command Pattern
-    Plant* plant = new Plant(1, PlantType::TOMATO, 0, 0);
+    PlantStore store(1);
+    Plant* plant = store.create(0, 1, PlantType::TOMATO, 0, 0);
     Command* waterCmd = new WaterPlantCommand(worker, plant);
     worker->addTask(waterCmd);
     bool hasTask = (worker->getTaskCount() > 0);
@@ -173,7 +173,6 @@ bool testWorkerSystem() {
     printTestResult("Experience & leveling system", leveledUp);
     
     delete worker;
-    delete plant;
     
     std::cout << "\n✓ Worker system tests completed!" << std::endl;
     return workerCreated && hasWaterer && hasHarvester && hasTask && 